@@ -0,0 +1,304 @@
+#include "bigint.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <new>
+#include <random>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Counts every global allocation so each benchmark can report allocations per operation.
+// Every allocation and deallocation form is replaced, as in test.cpp, so that none of
+// them mixes the library's allocator with this one, and the functions are kept out of
+// line so that the compiler does not see free() applied to the result of operator new.
+static std::atomic<size_t> allocation_count = 0;
+
+[[gnu::noinline]] void* operator new(size_t size) {
+    allocation_count.fetch_add(1, std::memory_order_relaxed);
+    if (void* ptr = std::malloc(size == 0 ? 1 : size)) return ptr;
+    throw std::bad_alloc();
+}
+
+[[gnu::noinline]] void* operator new(size_t size, std::align_val_t alignment) {
+    allocation_count.fetch_add(1, std::memory_order_relaxed);
+    const auto align = static_cast<size_t>(alignment);
+    const size_t rounded = (std::max<size_t>(size, 1) + align - 1) / align * align;
+    if (void* ptr = std::aligned_alloc(align, rounded)) return ptr;
+    throw std::bad_alloc();
+}
+
+[[gnu::noinline]] void operator delete(void* ptr) noexcept {
+    std::free(ptr);
+}
+
+[[gnu::noinline]] void operator delete(void* ptr, size_t) noexcept {
+    std::free(ptr);
+}
+
+[[gnu::noinline]] void operator delete(void* ptr, std::align_val_t) noexcept {
+    std::free(ptr);
+}
+
+[[gnu::noinline]] void operator delete(void* ptr, size_t, std::align_val_t) noexcept {
+    std::free(ptr);
+}
+
+/**
+ * @brief One measured operation at one operand size.
+ */
+struct result {
+    std::string name;
+    std::string shape;
+    std::string signs;
+    size_t digits = 0;
+    size_t iterations = 0;
+    double ns_per_op = 0;
+    double allocs_per_op = 0;
+
+    [[nodiscard]] std::string key() const {
+        return name + "/" + shape + "/" + signs + "/" + std::to_string(digits);
+    }
+};
+
+struct options {
+    size_t max_digits = 10000000;
+    double min_time = 0.2;
+    std::string format = "csv";
+    std::string filter;
+};
+
+static std::mt19937_64 rng(2024);
+static volatile bool compare_sink;
+
+/**
+ * @brief Returns a random decimal string of exactly digits digits, with the given sign.
+ */
+static std::string random_digits(size_t digits, bool negative) {
+    std::string s = negative ? "-" : "";
+    s += static_cast<char>('1' + rng() % 9);
+    for (size_t i = 1; i < digits; ++i) s += static_cast<char>('0' + rng() % 10);
+    return s;
+}
+
+/**
+ * @brief Runs op in batches of doubling size until a batch takes at least min_time,
+ *        then reports the time and allocations per call of that batch.
+ */
+static void measure(result& r, double min_time, const std::function<void()>& op) {
+    op();  // Warm up caches and tables built on first use.
+    for (size_t iterations = 1;; iterations *= 2) {
+        const size_t allocations = allocation_count.load(std::memory_order_relaxed);
+        const auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < iterations; ++i) op();
+        const double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        if (elapsed >= min_time || iterations >= (size_t{1} << 40)) {
+            r.iterations = iterations;
+            r.ns_per_op = elapsed * 1e9 / static_cast<double>(iterations);
+            r.allocs_per_op = static_cast<double>(allocation_count.load(std::memory_order_relaxed) - allocations) /
+                              static_cast<double>(iterations);
+            return;
+        }
+    }
+}
+
+static void print_header(const options& opt) {
+    if (opt.format == "csv") std::cout << "name,shape,signs,digits,iterations,ns_per_op,ops_per_sec,allocs_per_op\n";
+    if (opt.format == "json") std::cout << "[\n";
+}
+
+static void print_result(const options& opt, const result& r, bool first) {
+    const double ops_per_sec = r.ns_per_op > 0 ? 1e9 / r.ns_per_op : 0;
+    if (opt.format == "csv") {
+        std::cout << r.name << ',' << r.shape << ',' << r.signs << ',' << r.digits << ',' << r.iterations << ','
+                  << r.ns_per_op << ',' << ops_per_sec << ',' << r.allocs_per_op << '\n';
+    } else {
+        std::cout << (first ? "" : ",\n") << "  {\"name\": \"" << r.name << "\", \"shape\": \"" << r.shape
+                  << "\", \"signs\": \"" << r.signs << "\", \"digits\": " << r.digits << ", \"iterations\": "
+                  << r.iterations << ", \"ns_per_op\": " << r.ns_per_op << ", \"ops_per_sec\": " << ops_per_sec
+                  << ", \"allocs_per_op\": " << r.allocs_per_op << "}";
+    }
+    std::cout.flush();
+}
+
+static void print_footer(const options& opt) {
+    if (opt.format == "json") std::cout << "\n]\n";
+}
+
+/**
+ * @brief Times every operator at every size from 1 digit up to max_digits, in steps of 10.
+ */
+static void run(const options& opt) {
+    std::cout << std::setprecision(6);
+    print_header(opt);
+    bool first = true;
+    auto bench = [&](const std::string& name, const std::string& shape, const std::string& signs, size_t digits,
+                     const std::function<void()>& op) {
+        result r{name, shape, signs, digits};
+        if (!opt.filter.empty() && r.key().find(opt.filter) == std::string::npos) return;
+        measure(r, opt.min_time, op);
+        print_result(opt, r, first);
+        first = false;
+    };
+
+    bigint sink;
+    for (size_t digits = 1; digits <= opt.max_digits; digits *= 10) {
+        const std::string a_text = random_digits(digits, false);
+        const std::string b_text = random_digits(digits, false);
+        const std::string short_text = random_digits(std::max<size_t>(digits / 10, 1), false);
+        const bigint a(a_text);
+        const bigint b(b_text);
+        const bigint neg_a = -a;
+        const bigint neg_b = -b;
+        const bigint short_b(short_text);
+        std::vector<char> buffer(a.decimal_size());
+
+        if (digits <= 19) {
+            const int64_t native = std::stoll(a_text);
+            bench("construct", "int64", "+", digits, [&] { sink = bigint(native); });
+        }
+        bench("parse", "string", "+", digits, [&] { sink = bigint(a_text); });
+        bench("print", "to_chars", "+", digits, [&] {
+            (void)to_chars(buffer.data(), buffer.data() + buffer.size(), a);
+        });
+        bench("copy", "balanced", "+", digits, [&] { sink = a; });
+
+        bench("add", "balanced", "++", digits, [&] { sink = a + b; });
+        bench("add", "balanced", "+-", digits, [&] { sink = a + neg_b; });
+        bench("add", "balanced", "-+", digits, [&] { sink = neg_a + b; });
+        bench("add", "balanced", "--", digits, [&] { sink = neg_a + neg_b; });
+        bench("add", "unbalanced", "++", digits, [&] { sink = a + short_b; });
+        bench("sub", "balanced", "++", digits, [&] { sink = a - b; });
+        bench("sub", "balanced", "+-", digits, [&] { sink = a - neg_b; });
+        bench("sub", "balanced", "-+", digits, [&] { sink = neg_a - b; });
+        bench("sub", "balanced", "--", digits, [&] { sink = neg_a - neg_b; });
+        bench("sub", "unbalanced", "++", digits, [&] { sink = a - short_b; });
+        bench("mul", "balanced", "++", digits, [&] { sink = a * b; });
+        bench("mul", "balanced", "+-", digits, [&] { sink = a * neg_b; });
+        bench("mul", "balanced", "-+", digits, [&] { sink = neg_a * b; });
+        bench("mul", "balanced", "--", digits, [&] { sink = neg_a * neg_b; });
+        bench("mul", "unbalanced", "++", digits, [&] { sink = a * short_b; });
+        bench("mul", "square", "+", digits, [&] { sink = a * a; });
+
+        bigint a_copy = a;
+        bigint a_plus_one = a + 1;
+        bench("compare", "equal", "++", digits, [&] { compare_sink = a < a_copy; });
+        bench("compare", "last_limb", "++", digits, [&] { compare_sink = a < a_plus_one; });
+        bench("compare", "signs", "+-", digits, [&] { compare_sink = a < neg_b; });
+
+        bigint counter = a;
+        bench("increment", "in_place", "+", digits, [&] { ++counter; });
+        bench("add_assign", "in_place", "++", digits, [&] { counter += b; });
+    }
+    print_footer(opt);
+}
+
+/**
+ * @brief Reads the results of a previous run in either output format, as pairs of
+ *        benchmark key and time per operation in the order of the run.
+ */
+static std::vector<std::pair<std::string, double>> read_results(const std::string& path) {
+    std::ifstream in(path);
+    if (!in) throw std::invalid_argument("cannot open " + path);
+    std::vector<std::pair<std::string, double>> times;
+    std::string line;
+    while (std::getline(in, line)) {
+        const size_t brace = line.find('{');
+        if (brace != std::string::npos) {
+            auto field = [&](const std::string& key) {
+                const size_t at = line.find("\"" + key + "\": ", brace);
+                if (at == std::string::npos) return std::string();
+                size_t begin = at + key.size() + 4;
+                if (line[begin] == '"') ++begin;
+                return line.substr(begin, line.find_first_of("\",}", begin) - begin);
+            };
+            times.emplace_back(field("name") + "/" + field("shape") + "/" + field("signs") + "/" + field("digits"),
+                               std::stod(field("ns_per_op")));
+        } else if (!line.empty() && line.rfind("name,", 0) != 0 && line[0] != '[' && line[0] != ']') {
+            std::vector<std::string> cells;
+            std::stringstream row(line);
+            for (std::string cell; std::getline(row, cell, ',');) cells.push_back(cell);
+            if (cells.size() < 6) continue;
+            times.emplace_back(cells[0] + "/" + cells[1] + "/" + cells[2] + "/" + cells[3], std::stod(cells[5]));
+        }
+    }
+    return times;
+}
+
+/**
+ * @brief Prints the change of every benchmark present in both runs.
+ *
+ * @return 1 if any benchmark became slower by more than threshold percent, else 0.
+ */
+static int compare(const std::string& baseline_path, const std::string& current_path, double threshold) {
+    const auto baseline = read_results(baseline_path);
+    const auto current = read_results(current_path);
+    int regressions = 0;
+    std::cout << std::left << std::setw(40) << "benchmark" << std::right << std::setw(14) << "baseline ns"
+              << std::setw(14) << "current ns" << std::setw(10) << "change" << '\n';
+    for (const auto& [key, after] : current) {
+        const auto found = std::find_if(baseline.begin(), baseline.end(), [&](const auto& entry) { return entry.first == key; });
+        if (found == baseline.end()) continue;
+        const double change = (after / found->second - 1) * 100;
+        const bool regressed = change > threshold;
+        regressions += regressed;
+        std::cout << std::left << std::setw(40) << key << std::right << std::fixed << std::setprecision(1)
+                  << std::setw(14) << found->second << std::setw(14) << after << std::setw(9) << std::showpos
+                  << change << '%' << std::noshowpos << (regressed ? "  REGRESSION" : "") << '\n';
+    }
+    std::cout << regressions << " regression(s) above " << threshold << "%\n";
+    return regressions > 0 ? 1 : 0;
+}
+
+static void usage() {
+    std::cerr << "usage: bench [--format=csv|json] [--max-digits=N] [--min-time=SECONDS] [--filter=TEXT]\n"
+                 "       bench --compare BASELINE CURRENT [--threshold=PERCENT]\n";
+}
+
+int main(int argc, char** argv) {
+    options opt;
+    double threshold = 5;
+    std::vector<std::string> files;
+    bool comparing = false;
+    for (int i = 1; i < argc; ++i) {
+        const std::string_view arg = argv[i];
+        auto value = [&](std::string_view flag) { return std::string(arg.substr(flag.size())); };
+        if (arg.starts_with("--format=")) {
+            opt.format = value("--format=");
+        } else if (arg.starts_with("--max-digits=")) {
+            opt.max_digits = std::stoull(value("--max-digits="));
+        } else if (arg.starts_with("--min-time=")) {
+            opt.min_time = std::stod(value("--min-time="));
+        } else if (arg.starts_with("--filter=")) {
+            opt.filter = value("--filter=");
+        } else if (arg.starts_with("--threshold=")) {
+            threshold = std::stod(value("--threshold="));
+        } else if (arg == "--compare") {
+            comparing = true;
+        } else if (comparing && !arg.starts_with("--")) {
+            files.emplace_back(arg);
+        } else {
+            usage();
+            return 2;
+        }
+    }
+    if (comparing) {
+        if (files.size() != 2) {
+            usage();
+            return 2;
+        }
+        return compare(files[0], files[1], threshold);
+    }
+    if (opt.format != "csv" && opt.format != "json") {
+        usage();
+        return 2;
+    }
+    run(opt);
+    return 0;
+}
@@ -2,450 +2,4881 @@
 #define BIGINT_HPP
 
 #include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cerrno>
+#include <charconv>
+#include <chrono>
+#include <compare>
+#include <concepts>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <functional>
 #include <iostream>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <new>
 #include <ranges>
+#include <span>
 #include <stdexcept>
 #include <string>
+#include <string_view>
+#include <system_error>
+#include <thread>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
+#if defined(__x86_64__) && defined(__GNUC__) && !defined(BIGINT_GENERIC_KERNELS)
+#define BIGINT_X86_KERNELS
+#include <immintrin.h>
+#endif
+
+/*
+ * Crossover thresholds measured on the build machine by tune.cpp, when it has been run.
+ * Each one only takes effect if the matching macro is not already defined, and all can
+ * still be changed at runtime through bigint::tuning(). Define BIGINT_NO_TUNING_HEADER
+ * to build with the defaults below instead.
+ */
+#if !defined(BIGINT_NO_TUNING_HEADER) && __has_include("bigint_tuning.hpp")
+#include "bigint_tuning.hpp"
+#endif
+
 /**
- * @brief Compares the absolute values of the current bigint object
- *        with another bigint object to determine which is larger.
+ * @brief Number of limbs a bigint stores inline before spilling to the heap.
+ *        Can be overridden by defining the macro before including this header.
+ */
+#ifndef BIGINT_INLINE_LIMBS
+#define BIGINT_INLINE_LIMBS 2
+#endif
+
+/**
+ * @brief Size in characters of the buffer through which operator<< and write_file print
+ *        numbers too long for it; at least 1024. Can be overridden like BIGINT_INLINE_LIMBS.
+ */
+#ifndef BIGINT_STREAM_BUFFER_BYTES
+#define BIGINT_STREAM_BUFFER_BYTES (1 << 20)
+#endif
+
+/**
+ * @brief Low-level kernels operating on raw little-endian arrays of 64-bit limbs.
  *
- *        This method considers only the magnitudes of the numbers
- *        and does not take into account their signs.
+ *        These functions follow the conventions of the mpn layer of GMP: operands
+ *        are passed as pointer/length pairs, results are written to caller-provided
+ *        storage and carries or borrows are returned to the caller. They know nothing
+ *        about signs or normalization, which is handled by the bigint class itself.
+ */
+namespace bigint_detail {
+
+using limb_t = std::uint64_t;
+__extension__ typedef unsigned __int128 dlimb_t;
+
+inline constexpr int limb_bits = 64;
+
+/**
+ * @brief Largest power of ten that fits into a single limb, and its exponent.
+ *        Decimal conversion works on chunks of this many digits at once.
+ */
+inline constexpr limb_t decimal_chunk = 10000000000000000000ULL;
+inline constexpr std::size_t decimal_chunk_digits = 19;
+
+/**
+ * @brief Streams are parsed in blocks of 19 * 2^stream_block_level digits, so that
+ *        blocks combine through the squares of a power of the decimal conversion table, and
+ *        printed through a buffer of stream_buffer_bytes characters.
+ */
+inline constexpr std::size_t stream_block_level = 12;
+inline constexpr std::size_t stream_block_digits = decimal_chunk_digits << stream_block_level;
+inline constexpr std::size_t stream_buffer_bytes = BIGINT_STREAM_BUFFER_BYTES;
+static_assert(stream_buffer_bytes >= 1024, "BIGINT_STREAM_BUFFER_BYTES must be at least 1024");
+
+/**
+ * @brief Operations counted by the statistics, by the user-visible operation that ran.
+ */
+enum class operation_kind : std::size_t {
+    add,       ///< Addition of magnitudes, including the subtraction of a negative value.
+    subtract,  ///< Subtraction of magnitudes.
+    multiply,
+    square,
+    divide,    ///< Division and remainder.
+    powmod,
+    parse,     ///< Decimal parsing.
+    print,     ///< Decimal printing.
+};
+
+/**
+ * @brief Algorithms counted by the statistics, once for every call of each, recursive
+ *        calls included.
+ */
+enum class algorithm_kind : std::size_t {
+    mul_basecase,
+    sqr_basecase,
+    mul_unbalanced,
+    karatsuba,
+    toom3,
+    toom4,
+    ntt,
+    div_1,
+    div_basecase,
+    div_burnikel_ziegler,
+    powmod_montgomery,
+    powmod_division,
+    str_basecase,
+    str_divide_conquer,
+};
+
+inline constexpr std::size_t operation_count = 8;
+inline constexpr std::size_t algorithm_count = 14;
+
+/**
+ * @brief Number of operand-size buckets: bucket 0 holds operands of at most one limb,
+ *        bucket k those of more than 4^(k - 1) and at most 4^k limbs, and the last
+ *        bucket everything larger.
+ */
+inline constexpr std::size_t size_buckets = 10;
+
+constexpr std::size_t size_bucket(std::size_t limbs) {
+    return std::min<std::size_t>((std::bit_width(limbs > 0 ? limbs - 1 : 0) + 1) / 2, size_buckets - 1);
+}
+
+constexpr std::string_view name(operation_kind op) {
+    constexpr std::string_view names[operation_count] = {"add", "subtract", "multiply", "square",
+                                                         "divide", "powmod", "parse", "print"};
+    return names[static_cast<std::size_t>(op)];
+}
+
+constexpr std::string_view name(algorithm_kind algorithm) {
+    constexpr std::string_view names[algorithm_count] = {
+        "mul_basecase", "sqr_basecase", "mul_unbalanced", "karatsuba", "toom3",
+        "toom4", "ntt", "div_1", "div_basecase", "div_burnikel_ziegler",
+        "powmod_montgomery", "powmod_division", "str_basecase", "str_divide_conquer"};
+    return names[static_cast<std::size_t>(algorithm)];
+}
+
+/**
+ * @brief Counters of one kind of operation.
+ */
+struct operation_counters {
+    std::uint64_t count = 0;
+    std::uint64_t cycles = 0;  ///< Time stamp counter cycles, or nanoseconds off x86-64.
+    std::array<std::uint64_t, size_buckets> by_size{};
+};
+
+/**
+ * @brief Snapshot of the counters of one thread, returned by bigint::stats().
  *
- * @param value The bigint object to compare against.
- * @return True if the absolute value of the provided bigint object is larger
- *         than the absolute value of the current bigint object, otherwise false.
+ *        Operations are counted once per call made by the user: the additions and
+ *        products that multiplication, division and conversion perform internally are
+ *        part of the cost of the outer operation, and appear only in the algorithm
+ *        counts. Allocations are those of the limbs of bigint values, scratch
+ *        allocations those of the temporary buffers of the algorithms.
  */
-class bigint {
+struct statistics {
+    std::array<operation_counters, operation_count> operations{};
+    std::array<std::uint64_t, algorithm_count> algorithms{};
+    std::uint64_t allocations = 0;
+    std::uint64_t allocated_bytes = 0;
+    std::uint64_t deallocations = 0;
+    std::uint64_t scratch_allocations = 0;
+    std::uint64_t scratch_bytes = 0;
+
+    [[nodiscard]] const operation_counters& operator[](operation_kind op) const {
+        return operations[static_cast<std::size_t>(op)];
+    }
+
+    [[nodiscard]] std::uint64_t operator[](algorithm_kind algorithm) const {
+        return algorithms[static_cast<std::size_t>(algorithm)];
+    }
+};
+
+#ifdef BIGINT_ENABLE_STATS
+
+inline thread_local statistics thread_statistics;
+inline thread_local unsigned operation_depth = 0;
+
+inline std::uint64_t read_cycles() {
+#if defined(__x86_64__) && defined(__GNUC__)
+    return __builtin_ia32_rdtsc();
+#else
+    return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+#endif
+}
+
+/**
+ * @brief Counts an operation and the cycles until the end of its scope, unless it runs
+ *        inside another counted operation.
+ */
+class operation_timer {
+public:
+    constexpr operation_timer(operation_kind op, std::size_t limbs) {
+        if !consteval {
+            outermost_ = operation_depth++ == 0;
+            if (outermost_) {
+                op_ = op;
+                bucket_ = size_bucket(limbs);
+                start_ = read_cycles();
+            }
+        }
+    }
+
+    constexpr ~operation_timer() {
+        if !consteval {
+            --operation_depth;
+            if (outermost_) {
+                operation_counters& counters = thread_statistics.operations[static_cast<std::size_t>(op_)];
+                counters.cycles += read_cycles() - start_;
+                ++counters.count;
+                ++counters.by_size[bucket_];
+            }
+        }
+    }
+
+    operation_timer(const operation_timer&) = delete;
+    operation_timer& operator=(const operation_timer&) = delete;
+
+private:
+    operation_kind op_{};
+    std::size_t bucket_ = 0;
+    std::uint64_t start_ = 0;
+    bool outermost_ = false;
+};
+
+constexpr void count_algorithm(algorithm_kind algorithm) {
+    if !consteval {
+        ++thread_statistics.algorithms[static_cast<std::size_t>(algorithm)];
+    }
+}
+
+constexpr void count_allocation(std::size_t bytes) {
+    if !consteval {
+        ++thread_statistics.allocations;
+        thread_statistics.allocated_bytes += bytes;
+    }
+}
+
+constexpr void count_deallocation() {
+    if !consteval {
+        ++thread_statistics.deallocations;
+    }
+}
+
+#else
+
+// Without BIGINT_ENABLE_STATS the hooks are empty and compile to nothing.
+struct operation_timer {
+    constexpr operation_timer(operation_kind, std::size_t) {}
+};
+
+constexpr void count_algorithm(algorithm_kind) {}
+constexpr void count_allocation(std::size_t) {}
+constexpr void count_deallocation() {}
+
+#endif
+
+/**
+ * @brief Memory resource that bigints created on this thread, and the scratch buffers
+ *        of the algorithms running on it, allocate from; null selects the global heap.
+ *        Set through memory_scope.
+ */
+inline constinit thread_local std::pmr::memory_resource* scoped_resource = nullptr;
+
+/**
+ * @brief Routes the allocations of the current thread to a memory resource for the
+ *        lifetime of the scope, restoring the previous resource on exit. Scopes nest,
+ *        and a null resource selects the global heap again.
+ */
+class memory_scope {
+public:
+    explicit memory_scope(std::pmr::memory_resource* resource) noexcept : previous_(scoped_resource) {
+        scoped_resource = resource;
+    }
+
+    ~memory_scope() {
+        scoped_resource = previous_;
+    }
+
+    memory_scope(const memory_scope&) = delete;
+    memory_scope& operator=(const memory_scope&) = delete;
+
+private:
+    std::pmr::memory_resource* previous_;
+};
+
+/**
+ * @brief Allocator of the internal scratch buffers: a polymorphic allocator bound, when
+ *        default-constructed, to the resource of the enclosing memory_scope.
+ */
+template <typename T>
+class scratch_allocator : public std::pmr::polymorphic_allocator<T> {
+public:
+    scratch_allocator() noexcept
+        : std::pmr::polymorphic_allocator<T>(scoped_resource ? scoped_resource : std::pmr::new_delete_resource()) {}
+
+    template <typename U>
+    scratch_allocator(const scratch_allocator<U>& other) noexcept : std::pmr::polymorphic_allocator<T>(other.resource()) {}
+
+    scratch_allocator select_on_container_copy_construction() const { return {}; }
+
+#ifdef BIGINT_ENABLE_STATS
+    T* allocate(std::size_t n) {
+        ++thread_statistics.scratch_allocations;
+        thread_statistics.scratch_bytes += n * sizeof(T);
+        return std::pmr::polymorphic_allocator<T>::allocate(n);
+    }
+#endif
+};
+
+template <typename T>
+using scratch_vector = std::vector<T, scratch_allocator<T>>;
+
+/**
+ * @brief Adds two limb arrays of equal length, r = a + b, one limb at a time.
+ *
+ * @param r Destination of n limbs; may alias a or b.
+ * @return The carry out of the most significant limb (0 or 1).
+ */
+constexpr limb_t add_n_generic(limb_t* r, const limb_t* a, const limb_t* b, std::size_t n) {
+    limb_t carry = 0;
+    for (std::size_t i = 0; i < n; ++i) {
+        const limb_t s = a[i] + b[i];
+        const limb_t c1 = s < a[i];
+        r[i] = s + carry;
+        carry = c1 | (r[i] < s);
+    }
+    return carry;
+}
+
+/**
+ * @brief Subtracts two limb arrays of equal length, r = a - b, one limb at a time.
+ *
+ * @param r Destination of n limbs; may alias a or b.
+ * @return The borrow out of the most significant limb (0 or 1).
+ */
+constexpr limb_t sub_n_generic(limb_t* r, const limb_t* a, const limb_t* b, std::size_t n) {
+    limb_t borrow = 0;
+    for (std::size_t i = 0; i < n; ++i) {
+        const limb_t d = a[i] - b[i];
+        const limb_t b1 = a[i] < b[i];
+        r[i] = d - borrow;
+        borrow = b1 | (d < borrow);
+    }
+    return borrow;
+}
+
+/**
+ * @brief Compares two limb arrays of equal length, scanning down from the top.
+ *
+ * @return A negative value if a < b, zero if they are equal, a positive value if a > b.
+ */
+constexpr int cmp_n_generic(const limb_t* a, const limb_t* b, std::size_t n) {
+    while (n-- > 0) {
+        if (a[n] != b[n]) return a[n] < b[n] ? -1 : 1;
+    }
+    return 0;
+}
+
+/**
+ * @brief Multiplies a limb array by a single limb, r = a * b, in portable C++.
+ *
+ * @return The most significant limb of the product that did not fit into n limbs.
+ */
+constexpr limb_t mul_1_generic(limb_t* r, const limb_t* a, std::size_t n, limb_t b) {
+    limb_t carry = 0;
+    for (std::size_t i = 0; i < n; ++i) {
+        const dlimb_t p = static_cast<dlimb_t>(a[i]) * b + carry;
+        r[i] = static_cast<limb_t>(p);
+        carry = static_cast<limb_t>(p >> limb_bits);
+    }
+    return carry;
+}
+
+/**
+ * @brief Multiplies a limb array by a single limb and accumulates, r += a * b, in
+ *        portable C++.
+ *
+ * @return The carry limb out of the n-limb accumulator.
+ */
+constexpr limb_t addmul_1_generic(limb_t* r, const limb_t* a, std::size_t n, limb_t b) {
+    limb_t carry = 0;
+    for (std::size_t i = 0; i < n; ++i) {
+        const dlimb_t p = static_cast<dlimb_t>(a[i]) * b + r[i] + carry;
+        r[i] = static_cast<limb_t>(p);
+        carry = static_cast<limb_t>(p >> limb_bits);
+    }
+    return carry;
+}
+
+/**
+ * @brief Multiplies a limb array by a single limb and subtracts, r -= a * b, in
+ *        portable C++.
+ *
+ * @return The borrow limb to subtract from the limb above the n-limb accumulator.
+ */
+constexpr limb_t submul_1_generic(limb_t* r, const limb_t* a, std::size_t n, limb_t b) {
+    limb_t carry = 0;
+    for (std::size_t i = 0; i < n; ++i) {
+        const dlimb_t p = static_cast<dlimb_t>(a[i]) * b + carry;
+        const limb_t lo = static_cast<limb_t>(p);
+        const limb_t x = r[i];
+        r[i] = x - lo;
+        carry = static_cast<limb_t>(p >> limb_bits) + (x < lo);
+    }
+    return carry;
+}
+
+#ifdef BIGINT_X86_KERNELS
+
+/*
+ * The vector kernels add or subtract whole registers of limbs lane by lane and then
+ * resolve the carries between lanes with scalar arithmetic on the lane masks: with g
+ * the lanes that generate a carry and p the lanes that propagate one (a sum of all
+ * ones, or a difference of zero), the carry enters each lane whose bit differs between
+ * (g << 1) + p + carry and p, and leaves the register above the top lane. The scalar
+ * dependency between registers is a single addition and shift.
+ */
+
+__attribute__((target("avx2")))
+inline limb_t add_n_avx2(limb_t* r, const limb_t* a, const limb_t* b, std::size_t n) {
+    const __m256i sign = _mm256_set1_epi64x(INT64_MIN);
+    const __m256i ones = _mm256_set1_epi64x(-1);
+    const __m256i lanes = _mm256_setr_epi64x(1, 2, 4, 8);
+    unsigned carry = 0;
+    std::size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        const __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+        const __m256i y = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i));
+        const __m256i s = _mm256_add_epi64(x, y);
+        const __m256i overflow = _mm256_cmpgt_epi64(_mm256_xor_si256(x, sign), _mm256_xor_si256(s, sign));
+        const unsigned g = static_cast<unsigned>(_mm256_movemask_pd(_mm256_castsi256_pd(overflow)));
+        const unsigned p = static_cast<unsigned>(_mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(s, ones))));
+        const unsigned t = (g << 1) + p + carry;
+        const __m256i flip = _mm256_set1_epi64x(static_cast<long long>((t ^ p) & 15));
+        const __m256i increment = _mm256_cmpeq_epi64(_mm256_and_si256(flip, lanes), lanes);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(r + i), _mm256_sub_epi64(s, increment));
+        carry = t >> 4;
+    }
+    const limb_t s = add_n_generic(r + i, a + i, b + i, n - i);
+    // The tail starts without the carry; adding it to the tail can carry out only if the tail had not.
+    limb_t tail_carry = carry;
+    for (std::size_t j = i; tail_carry && j < n; ++j) {
+        tail_carry = ++r[j] == 0;
+    }
+    return s | tail_carry;
+}
+
+__attribute__((target("avx2")))
+inline limb_t sub_n_avx2(limb_t* r, const limb_t* a, const limb_t* b, std::size_t n) {
+    const __m256i sign = _mm256_set1_epi64x(INT64_MIN);
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i lanes = _mm256_setr_epi64x(1, 2, 4, 8);
+    unsigned borrow = 0;
+    std::size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        const __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+        const __m256i y = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i));
+        const __m256i d = _mm256_sub_epi64(x, y);
+        const __m256i underflow = _mm256_cmpgt_epi64(_mm256_xor_si256(y, sign), _mm256_xor_si256(x, sign));
+        const unsigned g = static_cast<unsigned>(_mm256_movemask_pd(_mm256_castsi256_pd(underflow)));
+        const unsigned p = static_cast<unsigned>(_mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(d, zero))));
+        const unsigned t = (g << 1) + p + borrow;
+        const __m256i flip = _mm256_set1_epi64x(static_cast<long long>((t ^ p) & 15));
+        const __m256i decrement = _mm256_cmpeq_epi64(_mm256_and_si256(flip, lanes), lanes);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(r + i), _mm256_add_epi64(d, decrement));
+        borrow = t >> 4;
+    }
+    const limb_t d = sub_n_generic(r + i, a + i, b + i, n - i);
+    limb_t tail_borrow = borrow;
+    for (std::size_t j = i; tail_borrow && j < n; ++j) {
+        tail_borrow = r[j]-- == 0;
+    }
+    return d | tail_borrow;
+}
+
+__attribute__((target("avx2")))
+inline int cmp_n_avx2(const limb_t* a, const limb_t* b, std::size_t n) {
+    for (; n >= 4; n -= 4) {
+        const __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + n - 4));
+        const __m256i y = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + n - 4));
+        const unsigned equal = static_cast<unsigned>(_mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(x, y))));
+        if (equal != 15) {
+            const std::size_t top = n - 4 + static_cast<std::size_t>(std::bit_width(~equal & 15u)) - 1;
+            return a[top] < b[top] ? -1 : 1;
+        }
+    }
+    return cmp_n_generic(a, b, n);
+}
+
+__attribute__((target("avx512f")))
+inline limb_t add_n_avx512(limb_t* r, const limb_t* a, const limb_t* b, std::size_t n) {
+    const __m512i ones = _mm512_set1_epi64(-1);
+    unsigned carry = 0;
+    std::size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        const __m512i x = _mm512_loadu_si512(a + i);
+        const __m512i s = _mm512_add_epi64(x, _mm512_loadu_si512(b + i));
+        const unsigned g = _mm512_cmplt_epu64_mask(s, x);
+        const unsigned p = _mm512_cmpeq_epi64_mask(s, ones);
+        const unsigned t = (g << 1) + p + carry;
+        _mm512_storeu_si512(r + i, _mm512_mask_sub_epi64(s, static_cast<__mmask8>(t ^ p), s, ones));
+        carry = t >> 8;
+    }
+    const limb_t s = add_n_generic(r + i, a + i, b + i, n - i);
+    limb_t tail_carry = carry;
+    for (std::size_t j = i; tail_carry && j < n; ++j) {
+        tail_carry = ++r[j] == 0;
+    }
+    return s | tail_carry;
+}
+
+__attribute__((target("avx512f")))
+inline limb_t sub_n_avx512(limb_t* r, const limb_t* a, const limb_t* b, std::size_t n) {
+    const __m512i ones = _mm512_set1_epi64(-1);
+    unsigned borrow = 0;
+    std::size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        const __m512i x = _mm512_loadu_si512(a + i);
+        const __m512i y = _mm512_loadu_si512(b + i);
+        const __m512i d = _mm512_sub_epi64(x, y);
+        const unsigned g = _mm512_cmplt_epu64_mask(x, y);
+        const unsigned p = _mm512_cmpeq_epi64_mask(d, _mm512_setzero_si512());
+        const unsigned t = (g << 1) + p + borrow;
+        _mm512_storeu_si512(r + i, _mm512_mask_add_epi64(d, static_cast<__mmask8>(t ^ p), d, ones));
+        borrow = t >> 8;
+    }
+    const limb_t d = sub_n_generic(r + i, a + i, b + i, n - i);
+    limb_t tail_borrow = borrow;
+    for (std::size_t j = i; tail_borrow && j < n; ++j) {
+        tail_borrow = r[j]-- == 0;
+    }
+    return d | tail_borrow;
+}
+
+__attribute__((target("avx512f")))
+inline int cmp_n_avx512(const limb_t* a, const limb_t* b, std::size_t n) {
+    for (; n >= 8; n -= 8) {
+        const unsigned differ = _mm512_cmpneq_epi64_mask(_mm512_loadu_si512(a + n - 8), _mm512_loadu_si512(b + n - 8));
+        if (differ != 0) {
+            const std::size_t top = n - 8 + static_cast<std::size_t>(std::bit_width(differ)) - 1;
+            return a[top] < b[top] ? -1 : 1;
+        }
+    }
+    return cmp_n_generic(a, b, n);
+}
+
+/*
+ * The MULX kernels keep two carry chains in flight: ADCX adds the high half of the
+ * previous product into the low half of the current one through the carry flag, while
+ * ADOX adds the result into r through the overflow flag. MULX itself leaves the flags
+ * alone, and the loops count with LEA and JRCXZ so that both chains survive from one
+ * limb to the next. submul_1 subtracts through the identity r - x = ~(~r + x). Each
+ * kernel handles n mod 4 limbs one at a time and the rest four at a time.
+ */
+
+#define BIGINT_MULX_LOOP(step)              \
+    "jmp 2f\n"                              \
+    "1:\n\t"                                \
+    step("0")                               \
+    "lea 8(%[a]), %[a]\n\t"                 \
+    "lea 8(%[r]), %[r]\n\t"                 \
+    "lea -1(%%rcx), %%rcx\n"                \
+    "2:\n\t"                                \
+    "jrcxz 3f\n\t"                          \
+    "jmp 1b\n"                              \
+    "3:\n\t"                                \
+    "mov %[blocks], %%rcx\n\t"              \
+    "jmp 5f\n"                              \
+    "4:\n\t"                                \
+    step("0") step("8") step("16") step("24") \
+    "lea 32(%[a]), %[a]\n\t"                \
+    "lea 32(%[r]), %[r]\n\t"                \
+    "lea -1(%%rcx), %%rcx\n"                \
+    "5:\n\t"                                \
+    "jrcxz 6f\n\t"                          \
+    "jmp 4b\n"                              \
+    "6:\n\t"
+
+#define BIGINT_MUL_1_STEP(offset)              \
+    "mulx " offset "(%[a]), %[lo], %[hi]\n\t"  \
+    "adcx %[c], %[lo]\n\t"                     \
+    "mov %[lo], " offset "(%[r])\n\t"          \
+    "mov %[hi], %[c]\n\t"
+
+#define BIGINT_ADDMUL_1_STEP(offset)           \
+    "mulx " offset "(%[a]), %[lo], %[hi]\n\t"  \
+    "adcx %[c], %[lo]\n\t"                     \
+    "adox " offset "(%[r]), %[lo]\n\t"         \
+    "mov %[lo], " offset "(%[r])\n\t"          \
+    "mov %[hi], %[c]\n\t"
+
+#define BIGINT_SUBMUL_1_STEP(offset)           \
+    "mulx " offset "(%[a]), %[lo], %[hi]\n\t"  \
+    "adcx %[c], %[lo]\n\t"                     \
+    "mov " offset "(%[r]), %[c]\n\t"           \
+    "not %[c]\n\t"                             \
+    "adox %[lo], %[c]\n\t"                     \
+    "not %[c]\n\t"                             \
+    "mov %[c], " offset "(%[r])\n\t"           \
+    "mov %[hi], %[c]\n\t"
+
+inline limb_t mul_1_mulx(limb_t* r, const limb_t* a, std::size_t n, limb_t b) {
+    limb_t c, lo, hi;
+    std::size_t count = n & 3;
+    __asm__ volatile(
+        "xor %k[c], %k[c]\n"
+        BIGINT_MULX_LOOP(BIGINT_MUL_1_STEP)
+        "mov $0, %k[lo]\n\t"
+        "adcx %[lo], %[c]\n\t"
+        : [c] "=&r"(c), [lo] "=&r"(lo), [hi] "=&r"(hi), [r] "+r"(r), [a] "+r"(a), "+c"(count)
+        : [blocks] "r"(n >> 2), "d"(b)
+        : "cc", "memory");
+    return c;
+}
+
+inline limb_t addmul_1_mulx(limb_t* r, const limb_t* a, std::size_t n, limb_t b) {
+    limb_t c, lo, hi;
+    std::size_t count = n & 3;
+    __asm__ volatile(
+        "xor %k[c], %k[c]\n"
+        BIGINT_MULX_LOOP(BIGINT_ADDMUL_1_STEP)
+        "mov $0, %k[lo]\n\t"
+        "adcx %[lo], %[c]\n\t"
+        "adox %[lo], %[c]\n\t"
+        : [c] "=&r"(c), [lo] "=&r"(lo), [hi] "=&r"(hi), [r] "+r"(r), [a] "+r"(a), "+c"(count)
+        : [blocks] "r"(n >> 2), "d"(b)
+        : "cc", "memory");
+    return c;
+}
+
+inline limb_t submul_1_mulx(limb_t* r, const limb_t* a, std::size_t n, limb_t b) {
+    limb_t c, lo, hi;
+    std::size_t count = n & 3;
+    __asm__ volatile(
+        "xor %k[c], %k[c]\n"
+        BIGINT_MULX_LOOP(BIGINT_SUBMUL_1_STEP)
+        "mov $0, %k[lo]\n\t"
+        "adcx %[lo], %[c]\n\t"
+        "adox %[lo], %[c]\n\t"
+        : [c] "=&r"(c), [lo] "=&r"(lo), [hi] "=&r"(hi), [r] "+r"(r), [a] "+r"(a), "+c"(count)
+        : [blocks] "r"(n >> 2), "d"(b)
+        : "cc", "memory");
+    return c;
+}
+
+#undef BIGINT_MULX_LOOP
+#undef BIGINT_MUL_1_STEP
+#undef BIGINT_ADDMUL_1_STEP
+#undef BIGINT_SUBMUL_1_STEP
+
+#endif
+
+/**
+ * @brief Instruction set levels for which the library has dedicated kernels.
+ */
+enum class cpu_level { generic, avx2, avx512 };
+
+/**
+ * @brief Returns the highest kernel level the running processor and operating system support.
+ */
+inline cpu_level detect_cpu_level() {
+#ifdef BIGINT_X86_KERNELS
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f")) return cpu_level::avx512;
+    if (__builtin_cpu_supports("avx2")) return cpu_level::avx2;
+#endif
+    return cpu_level::generic;
+}
+
+/**
+ * @brief Returns whether the running processor has the MULX and ADCX/ADOX instructions
+ *        of the BMI2 and ADX extensions.
+ */
+inline bool detect_mulx_adx() {
+#ifdef BIGINT_X86_KERNELS
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("bmi2") && __builtin_cpu_supports("adx");
+#else
+    return false;
+#endif
+}
+
+/**
+ * @brief Entry points of the kernels that have processor-specific implementations.
+ */
+struct kernel_table {
+    limb_t (*add_n)(limb_t* r, const limb_t* a, const limb_t* b, std::size_t n);
+    limb_t (*sub_n)(limb_t* r, const limb_t* a, const limb_t* b, std::size_t n);
+    int (*cmp_n)(const limb_t* a, const limb_t* b, std::size_t n);
+    limb_t (*mul_1)(limb_t* r, const limb_t* a, std::size_t n, limb_t b);
+    limb_t (*addmul_1)(limb_t* r, const limb_t* a, std::size_t n, limb_t b);
+    limb_t (*submul_1)(limb_t* r, const limb_t* a, std::size_t n, limb_t b);
+};
+
+/**
+ * @brief Returns the kernels for a vector instruction set level and, with mulx_adx,
+ *        the multiply-accumulate kernels built on MULX and ADCX/ADOX, falling back to
+ *        the portable ones for whatever this build has no kernels for.
+ */
+inline kernel_table select_kernels(cpu_level level, bool mulx_adx = false) {
+    kernel_table table{add_n_generic, sub_n_generic, cmp_n_generic,
+                       mul_1_generic, addmul_1_generic, submul_1_generic};
+#ifdef BIGINT_X86_KERNELS
+    if (level == cpu_level::avx512) {
+        table.add_n = add_n_avx512;
+        table.sub_n = sub_n_avx512;
+        table.cmp_n = cmp_n_avx512;
+    } else if (level == cpu_level::avx2) {
+        table.add_n = add_n_avx2;
+        table.sub_n = sub_n_avx2;
+        table.cmp_n = cmp_n_avx2;
+    }
+    if (mulx_adx) {
+        table.mul_1 = mul_1_mulx;
+        table.addmul_1 = addmul_1_mulx;
+        table.submul_1 = submul_1_mulx;
+    }
+#else
+    (void)level;
+    (void)mulx_adx;
+#endif
+    return table;
+}
+
+/**
+ * @brief The kernels in use, chosen once during static initialization from the
+ *        features of the running processor. Operands shorter than dispatch_limbs skip
+ *        the indirect call and use the portable loops, which are as fast at that size.
+ */
+inline kernel_table kernels = select_kernels(detect_cpu_level(), detect_mulx_adx());
+inline constexpr std::size_t dispatch_limbs = 8;
+
+/**
+ * @brief Adds a single carry limb to a limb array, r = a + carry, stopping as soon
+ *        as the carry is absorbed.
+ *
+ * @param r Destination of n limbs; may alias a, in which case the limbs above the
+ *          last one changed are not touched.
+ * @return The carry out of the most significant limb.
+ */
+constexpr limb_t add_1(limb_t* r, const limb_t* a, std::size_t n, limb_t carry) {
+    std::size_t i = 0;
+    for (; carry != 0 && i < n; ++i) {
+        r[i] = a[i] + carry;
+        carry = r[i] < carry;
+    }
+    if (r != a) std::copy(a + i, a + n, r + i);
+    return carry;
+}
+
+/**
+ * @brief Subtracts a single borrow limb from a limb array, r = a - borrow, stopping as
+ *        soon as the borrow is absorbed.
+ *
+ * @param r Destination of n limbs; may alias a, in which case the limbs above the
+ *          last one changed are not touched.
+ * @return The borrow out of the most significant limb.
+ */
+constexpr limb_t sub_1(limb_t* r, const limb_t* a, std::size_t n, limb_t borrow) {
+    std::size_t i = 0;
+    for (; borrow != 0 && i < n; ++i) {
+        const limb_t x = a[i];
+        r[i] = x - borrow;
+        borrow = x < borrow;
+    }
+    if (r != a) std::copy(a + i, a + n, r + i);
+    return borrow;
+}
+
+/**
+ * @brief Adds two limb arrays, r = a + b.
+ *
+ * @param r Destination with room for an limbs; may alias a or b.
+ * @param a The longer operand.
+ * @param an Number of limbs in a.
+ * @param b The shorter operand.
+ * @param bn Number of limbs in b, must not exceed an.
+ * @return The carry out of the most significant limb (0 or 1).
+ */
+constexpr limb_t add(limb_t* r, const limb_t* a, std::size_t an, const limb_t* b, std::size_t bn) {
+    const limb_t carry = !std::is_constant_evaluated() && bn >= dispatch_limbs ? kernels.add_n(r, a, b, bn) : add_n_generic(r, a, b, bn);
+    return add_1(r + bn, a + bn, an - bn, carry);
+}
+
+/**
+ * @brief Subtracts two limb arrays, r = a - b.
+ *
+ * @param r Destination with room for an limbs; may alias a or b.
+ * @param a The minuend.
+ * @param an Number of limbs in a.
+ * @param b The subtrahend.
+ * @param bn Number of limbs in b, must not exceed an.
+ * @return The borrow out of the most significant limb (0 or 1).
+ */
+constexpr limb_t sub(limb_t* r, const limb_t* a, std::size_t an, const limb_t* b, std::size_t bn) {
+    const limb_t borrow = !std::is_constant_evaluated() && bn >= dispatch_limbs ? kernels.sub_n(r, a, b, bn) : sub_n_generic(r, a, b, bn);
+    return sub_1(r + bn, a + bn, an - bn, borrow);
+}
+
+/**
+ * @brief Compares two normalized limb arrays by magnitude.
+ *
+ * @return A negative value if a < b, zero if they are equal, a positive value if a > b.
+ */
+constexpr int cmp(const limb_t* a, std::size_t an, const limb_t* b, std::size_t bn) {
+    if (an != bn) return an < bn ? -1 : 1;
+    return !std::is_constant_evaluated() && an >= dispatch_limbs ? kernels.cmp_n(a, b, an) : cmp_n_generic(a, b, an);
+}
+
+/**
+ * @brief Multiplies a limb array by a single limb, r = a * b.
+ *
+ * @param r Destination of n limbs; may alias a.
+ * @return The most significant limb of the product that did not fit into n limbs.
+ */
+constexpr limb_t mul_1(limb_t* r, const limb_t* a, std::size_t n, limb_t b) {
+    return !std::is_constant_evaluated() && n >= dispatch_limbs ? kernels.mul_1(r, a, n, b) : mul_1_generic(r, a, n, b);
+}
+
+/**
+ * @brief Multiplies a limb array by a single limb and accumulates, r += a * b.
+ *
+ * @return The carry limb out of the n-limb accumulator.
+ */
+constexpr limb_t addmul_1(limb_t* r, const limb_t* a, std::size_t n, limb_t b) {
+    return !std::is_constant_evaluated() && n >= dispatch_limbs ? kernels.addmul_1(r, a, n, b) : addmul_1_generic(r, a, n, b);
+}
+
+/**
+ * @brief Multiplies a limb array by a single limb and subtracts, r -= a * b.
+ *
+ * @return The borrow limb to subtract from the limb above the n-limb accumulator.
+ */
+constexpr limb_t submul_1(limb_t* r, const limb_t* a, std::size_t n, limb_t b) {
+    return !std::is_constant_evaluated() && n >= dispatch_limbs ? kernels.submul_1(r, a, n, b) : submul_1_generic(r, a, n, b);
+}
+
+/**
+ * @brief Schoolbook multiplication, r = a * b.
+ *
+ * @param r Destination of an + bn limbs; must not overlap a or b.
+ */
+constexpr void mul_basecase(limb_t* r, const limb_t* a, std::size_t an, const limb_t* b, std::size_t bn) {
+    r[an] = mul_1(r, a, an, b[0]);
+    for (std::size_t j = 1; j < bn; ++j) {
+        r[an + j] = addmul_1(r + j, a, an, b[j]);
+    }
+}
+
+/**
+ * @brief Divides a limb array by a single limb, q = a / d.
+ *
+ * @param q Destination of n limbs for the quotient; may alias a.
+ * @return The remainder of the division.
+ */
+constexpr limb_t divrem_1(limb_t* q, const limb_t* a, std::size_t n, limb_t d) {
+    limb_t rem = 0;
+    for (std::size_t i = n; i-- > 0;) {
+        const dlimb_t cur = (static_cast<dlimb_t>(rem) << limb_bits) | a[i];
+        q[i] = static_cast<limb_t>(cur / d);
+        rem = static_cast<limb_t>(cur % d);
+    }
+    return rem;
+}
+
+/**
+ * @brief Schoolbook long division (Knuth, TAOCP vol. 2, algorithm D) by a normalized
+ *        divisor of at least two limbs.
+ *
+ *        Each quotient limb is estimated from the top two limbs of the running
+ *        remainder and the top limb of the divisor, refined against the second divisor
+ *        limb so that it is at most one too large, and corrected by a single add-back.
+ *
+ * @param q Destination of nn - dn limbs for the quotient, below the returned limb.
+ * @param n The dividend of nn >= dn limbs; overwritten with the remainder in its low dn limbs.
+ * @param d The divisor of dn >= 2 limbs, with the top bit of d[dn - 1] set.
+ * @return The most significant quotient limb, 0 or 1.
+ */
+inline limb_t divrem_basecase(limb_t* q, limb_t* n, std::size_t nn, const limb_t* d, std::size_t dn) {
+    limb_t* top = n + nn - dn;
+    const limb_t qh = cmp(top, dn, d, dn) >= 0;
+    if (qh) sub(top, top, dn, d, dn);
+    const limb_t d1 = d[dn - 1];
+    const limb_t d0 = d[dn - 2];
+    for (std::size_t i = nn - dn; i-- > 0;) {
+        const limb_t n2 = n[i + dn];
+        const dlimb_t num = (static_cast<dlimb_t>(n2) << limb_bits) | n[i + dn - 1];
+        dlimb_t qhat = num / d1;
+        dlimb_t rhat = num - qhat * d1;
+        while ((qhat >> limb_bits) != 0 ||
+               qhat * d0 > ((rhat << limb_bits) | n[i + dn - 2])) {
+            --qhat;
+            rhat += d1;
+            if ((rhat >> limb_bits) != 0) break;
+        }
+        const limb_t borrow = submul_1(n + i, d, dn, static_cast<limb_t>(qhat));
+        n[i + dn] = n2 - borrow;
+        if (n2 < borrow) {
+            --qhat;
+            n[i + dn] += add(n + i, n + i, dn, d, dn);
+        }
+        q[i] = static_cast<limb_t>(qhat);
+    }
+    return qh;
+}
+
+/**
+ * @brief Shifts a limb array left by 1 to 63 bits, r = a << count.
+ *
+ * @param r Destination of n limbs; may alias a.
+ * @return The bits shifted out of the most significant limb.
+ */
+constexpr limb_t lshift(limb_t* r, const limb_t* a, std::size_t n, unsigned count) {
+    const unsigned back = limb_bits - count;
+    limb_t out = 0;
+    for (std::size_t i = n; i-- > 0;) {
+        const limb_t limb = a[i];
+        if (i + 1 == n) out = limb >> back;
+        r[i] = (limb << count) | (i > 0 ? a[i - 1] >> back : 0);
+    }
+    return out;
+}
+
+/**
+ * @brief Shifts a limb array right by 1 to 63 bits, r = a >> count.
+ *
+ * @param r Destination of n limbs; may alias a.
+ * @return The bits shifted out of the least significant limb, in the high bits of the result.
+ */
+constexpr limb_t rshift(limb_t* r, const limb_t* a, std::size_t n, unsigned count) {
+    const unsigned back = limb_bits - count;
+    const limb_t out = a[0] << back;
+    for (std::size_t i = 0; i < n; ++i) {
+        r[i] = (a[i] >> count) | (i + 1 < n ? a[i + 1] << back : 0);
+    }
+    return out;
+}
+
+/**
+ * @brief Computes the inverse of an odd limb modulo 2^64 by Newton iteration.
+ */
+inline limb_t inverse_limb(limb_t d) {
+    limb_t inv = d;
+    for (int i = 0; i < 5; ++i) inv *= 2 - d * inv;
+    return inv;
+}
+
+/**
+ * @brief Divides a limb array by an odd single limb known to divide it exactly, q = a / d.
+ *
+ *        Works from the least significant limb upwards by multiplying with the modular
+ *        inverse of d, which avoids hardware division entirely.
+ *
+ * @param q Destination of n limbs; may alias a.
+ */
+inline void divexact_1(limb_t* q, const limb_t* a, std::size_t n, limb_t d) {
+    const limb_t inv = inverse_limb(d);
+    limb_t carry = 0;
+    for (std::size_t i = 0; i < n; ++i) {
+        const limb_t s = a[i];
+        const limb_t l = s - carry;
+        carry = l > s;
+        const limb_t quot = l * inv;
+        q[i] = quot;
+        carry += static_cast<limb_t>((static_cast<dlimb_t>(quot) * d) >> limb_bits);
+    }
+}
+
+/**
+ * @brief Schoolbook squaring, r = a * a.
+ *
+ *        Forms each cross product a[i] * a[j] with i < j once, doubles their sum with a
+ *        one-bit shift and adds the squares a[i] * a[i] on the diagonal, which takes
+ *        about half the single-limb multiplications of mul_basecase.
+ *
+ * @param r Destination of 2 * n limbs; must not overlap a.
+ */
+constexpr void sqr_basecase(limb_t* r, const limb_t* a, std::size_t n) {
+    r[0] = 0;
+    r[2 * n - 1] = 0;
+    if (n > 1) {
+        r[n] = mul_1(r + 1, a + 1, n - 1, a[0]);
+        for (std::size_t i = 1; i + 1 < n; ++i) {
+            r[n + i] = addmul_1(r + 2 * i + 1, a + i + 1, n - i - 1, a[i]);
+        }
+        r[2 * n - 1] = lshift(r + 1, r + 1, 2 * n - 2, 1);
+    }
+    limb_t carry = 0;
+    for (std::size_t i = 0; i < n; ++i) {
+        const dlimb_t square = static_cast<dlimb_t>(a[i]) * a[i];
+        dlimb_t sum = static_cast<dlimb_t>(r[2 * i]) + static_cast<limb_t>(square) + carry;
+        r[2 * i] = static_cast<limb_t>(sum);
+        sum = static_cast<dlimb_t>(r[2 * i + 1]) + static_cast<limb_t>(square >> limb_bits) + (sum >> limb_bits);
+        r[2 * i + 1] = static_cast<limb_t>(sum);
+        carry = static_cast<limb_t>(sum >> limb_bits);
+    }
+}
+
+/**
+ * @brief Montgomery reduction, r = t / 2^(64 * n) mod m, one limb of t at a time.
+ *
+ *        Each step adds the multiple of m that clears the lowest remaining limb of t,
+ *        parking the carry in the limb just cleared; the parked carries are added to
+ *        the upper half at the end.
+ *
+ * @param r Destination of n limbs, fully reduced below m; may alias the upper half of t.
+ * @param t The value to reduce, of 2 * n limbs, below m * 2^(64 * n); overwritten.
+ * @param m The odd modulus of n limbs.
+ * @param minv The negated inverse of m[0] modulo 2^64.
+ */
+inline void redc_1(limb_t* r, limb_t* t, const limb_t* m, std::size_t n, limb_t minv) {
+    for (std::size_t i = 0; i < n; ++i) {
+        t[i] = addmul_1(t + i, m, n, t[i] * minv);
+    }
+    const limb_t carry = add(r, t + n, n, t, n);
+    if (carry != 0 || cmp(r, n, m, n) >= 0) sub(r, r, n, m, n);
+}
+
+/**
+ * @brief Calls step(i) for each i from 0 to N - 1, with i a std::integral_constant, so
+ *        the loop is unrolled whatever the optimizer decides.
+ */
+template <std::size_t N, typename F>
+constexpr void unroll(F&& step) {
+    [&]<std::size_t... I>(std::index_sequence<I...>) {
+        (step(std::integral_constant<std::size_t, I>{}), ...);
+    }(std::make_index_sequence<N>{});
+}
+
+/**
+ * @brief Adds two limbs and a carry, sum = a + b + carry. On x86-64 this is a single
+ *        ADC, so an unrolled run of calls forms one carry chain.
+ *
+ * @return The carry out (0 or 1).
+ */
+constexpr limb_t add_carry(limb_t a, limb_t b, limb_t carry, limb_t& sum) {
+#ifdef BIGINT_X86_KERNELS
+    if !consteval {
+        unsigned long long out;
+        const unsigned char c = _addcarry_u64(static_cast<unsigned char>(carry), a, b, &out);
+        sum = out;
+        return c;
+    }
+#endif
+    const limb_t s = a + b;
+    const limb_t c1 = s < a;
+    sum = s + carry;
+    return c1 | (sum < s);
+}
+
+/**
+ * @brief Subtracts a limb and a borrow from a limb, difference = a - b - borrow. On
+ *        x86-64 this is a single SBB.
+ *
+ * @return The borrow out (0 or 1).
+ */
+constexpr limb_t sub_borrow(limb_t a, limb_t b, limb_t borrow, limb_t& difference) {
+#ifdef BIGINT_X86_KERNELS
+    if !consteval {
+        unsigned long long out;
+        const unsigned char c = _subborrow_u64(static_cast<unsigned char>(borrow), a, b, &out);
+        difference = out;
+        return c;
+    }
+#endif
+    const limb_t d = a - b;
+    const limb_t b1 = a < b;
+    difference = d - borrow;
+    return b1 | (d < borrow);
+}
+
+/**
+ * @brief Number of limbs from which the fixed-width operations call the dispatched
+ *        kernels instead of unrolling, as the unrolled code outgrows the caches. Up to
+ *        15 limbs (960 bits) the unrolled code is faster, an addition taking 4 ns
+ *        against 33 ns through the kernels; from 16 limbs the kernels win.
+ */
+inline constexpr std::size_t fixed_unroll_limbs = 16;
+
+/**
+ * @brief Adds two arrays of exactly N limbs, r = a + b.
+ *
+ * @param r Destination of N limbs; may alias a or b.
+ * @return The carry out of the most significant limb (0 or 1).
+ */
+template <std::size_t N>
+constexpr limb_t add_fixed(limb_t* r, const limb_t* a, const limb_t* b) {
+    if constexpr (N >= fixed_unroll_limbs) {
+        return add(r, a, N, b, N);
+    } else {
+        limb_t carry = 0;
+        unroll<N>([&](std::size_t i) { carry = add_carry(a[i], b[i], carry, r[i]); });
+        return carry;
+    }
+}
+
+/**
+ * @brief Subtracts two arrays of exactly N limbs, r = a - b.
+ *
+ * @param r Destination of N limbs; may alias a or b.
+ * @return The borrow out of the most significant limb (0 or 1).
+ */
+template <std::size_t N>
+constexpr limb_t sub_fixed(limb_t* r, const limb_t* a, const limb_t* b) {
+    if constexpr (N >= fixed_unroll_limbs) {
+        return sub(r, a, N, b, N);
+    } else {
+        limb_t borrow = 0;
+        unroll<N>([&](std::size_t i) { borrow = sub_borrow(a[i], b[i], borrow, r[i]); });
+        return borrow;
+    }
+}
+
+/**
+ * @brief Multiplies two arrays of exactly N limbs, keeping the low N limbs of the
+ *        product, r = a * b mod 2^(64 * N).
+ *
+ *        Only the partial products that reach the low half are formed, about half of
+ *        those of a full product.
+ *
+ * @param r Destination of N limbs; must not overlap a or b.
+ */
+template <std::size_t N>
+constexpr void mul_fixed(limb_t* r, const limb_t* a, const limb_t* b) {
+    if constexpr (N >= fixed_unroll_limbs) {
+        mul_1(r, a, N, b[0]);
+        for (std::size_t j = 1; j < N; ++j) addmul_1(r + j, a, N - j, b[j]);
+    } else {
+        unroll<N>([&](auto j) {
+            limb_t carry = 0;
+            unroll<N - j - 1>([&](std::size_t i) {
+                const dlimb_t p = static_cast<dlimb_t>(a[i]) * b[j] + (j == 0 ? 0 : r[i + j]) + carry;
+                r[i + j] = static_cast<limb_t>(p);
+                carry = static_cast<limb_t>(p >> limb_bits);
+            });
+            const limb_t top = a[N - 1 - j] * b[j] + carry;
+            r[N - 1] = j == 0 ? top : r[N - 1] + top;
+        });
+    }
+}
+
+/**
+ * @brief Lists the odd primes up to n in increasing order, by a sieve of Eratosthenes
+ *        over the odd numbers.
+ */
+inline scratch_vector<limb_t> odd_primes(limb_t n) {
+    scratch_vector<limb_t> primes;
+    if (n < 3) return primes;
+    // Index i stands for the odd number 2i + 1.
+    const auto last = static_cast<std::size_t>((n - 1) / 2);
+    std::vector<bool> composite(last + 1);
+    for (std::size_t i = 1; i <= last; ++i) {
+        if (composite[i]) continue;
+        const limb_t p = 2 * i + 1;
+        primes.push_back(p);
+        if (p > n / p) continue;
+        for (auto j = static_cast<std::size_t>(p * p / 2); j <= last; j += p) composite[j] = true;
+    }
+    return primes;
+}
+
+/**
+ * @brief Throws the std::ios_base::failure for a failed file operation on path.
+ */
+[[noreturn]] inline void file_error(const char* what, const std::filesystem::path& path, int error) {
+    throw std::ios_base::failure(std::string(what) + " " + path.string(), std::error_code(error, std::generic_category()));
+}
+
+#ifndef BIGINT_MUL_KARATSUBA_THRESHOLD
+#define BIGINT_MUL_KARATSUBA_THRESHOLD 32
+#endif
+#ifndef BIGINT_MUL_TOOM3_THRESHOLD
+#define BIGINT_MUL_TOOM3_THRESHOLD 256
+#endif
+#ifndef BIGINT_MUL_TOOM4_THRESHOLD
+#define BIGINT_MUL_TOOM4_THRESHOLD 768
+#endif
+#ifndef BIGINT_MUL_NTT_THRESHOLD
+#define BIGINT_MUL_NTT_THRESHOLD 65536
+#endif
+#ifndef BIGINT_DIV_BURNIKEL_ZIEGLER_THRESHOLD
+#define BIGINT_DIV_BURNIKEL_ZIEGLER_THRESHOLD 40
+#endif
+#ifndef BIGINT_POWMOD_DIVISION_THRESHOLD
+#define BIGINT_POWMOD_DIVISION_THRESHOLD 256
+#endif
+#ifndef BIGINT_STR_DIVIDE_CONQUER_THRESHOLD
+#define BIGINT_STR_DIVIDE_CONQUER_THRESHOLD 30
+#endif
+#ifndef BIGINT_SQR_KARATSUBA_THRESHOLD
+#define BIGINT_SQR_KARATSUBA_THRESHOLD 80
+#endif
+
+/**
+ * @brief Operand sizes, in limbs, at which multiplication, division, modular
+ *        exponentiation and decimal conversion switch algorithm.
+ *
+ *        Each mul_ field is the smallest size of the shorter operand for which the named
+ *        algorithm is used in preference to the previous one; div_burnikel_ziegler is the
+ *        smallest divisor and quotient size for which division recurses, powmod_division
+ *        the smallest odd modulus that powmod reduces by division rather than in
+ *        Montgomery form, str_divide_conquer the smallest number for which decimal
+ *        parsing and printing split the number in two, and sqr_karatsuba the size at
+ *        which squares leave the squaring kernel for Karatsuba. The defaults can be set
+ *        at compile time through the matching BIGINT_*_THRESHOLD macros and changed at
+ *        runtime through bigint::tuning().
+ */
+struct tuning_parameters {
+    std::size_t mul_karatsuba = BIGINT_MUL_KARATSUBA_THRESHOLD;
+    std::size_t mul_toom3 = BIGINT_MUL_TOOM3_THRESHOLD;
+    std::size_t mul_toom4 = BIGINT_MUL_TOOM4_THRESHOLD;
+    std::size_t mul_ntt = BIGINT_MUL_NTT_THRESHOLD;
+    std::size_t div_burnikel_ziegler = BIGINT_DIV_BURNIKEL_ZIEGLER_THRESHOLD;
+    std::size_t powmod_division = BIGINT_POWMOD_DIVISION_THRESHOLD;
+    std::size_t str_divide_conquer = BIGINT_STR_DIVIDE_CONQUER_THRESHOLD;
+    std::size_t sqr_karatsuba = BIGINT_SQR_KARATSUBA_THRESHOLD;
+};
+
+inline tuning_parameters tuning{};
+
+#ifndef BIGINT_PARALLEL_GRAIN
+#define BIGINT_PARALLEL_GRAIN 2048
+#endif
+
+/**
+ * @brief Settings of the opt-in parallel multiplication mode.
+ *
+ *        With threads greater than one, sub-products whose shorter operand has at least
+ *        grain limbs are scheduled on the shared thread pool, as are the NTT transforms
+ *        and butterfly stages of at least grain points. Set through bigint::set_parallelism().
+ */
+struct parallel_parameters {
+    std::size_t threads = 0;
+    std::size_t grain = BIGINT_PARALLEL_GRAIN;
+};
+
+inline parallel_parameters parallel{};
+
+/**
+ * @brief Fixed-size pool of worker threads with per-worker work-stealing queues.
+ *
+ *        Workers push and pop their own tasks at the back of their queue and steal
+ *        from the front of the others'. Threads outside the pool submit to a separate
+ *        injection queue. Threads that wait for tasks run pending tasks meanwhile, so
+ *        nested fork-join parallelism never deadlocks.
+ */
+class thread_pool {
+public:
+    explicit thread_pool(std::size_t workers) : queues(workers + 1) {
+        for (auto& queue : queues) queue = std::make_unique<task_queue>();
+        threads.reserve(workers);
+        for (std::size_t i = 0; i < workers; ++i) {
+            threads.emplace_back([this, i] { work(i); });
+        }
+    }
+
+    thread_pool(const thread_pool&) = delete;
+    thread_pool& operator=(const thread_pool&) = delete;
+
+    ~thread_pool() {
+        {
+            std::lock_guard<std::mutex> lock(sleep_mutex);
+            stopping = true;
+        }
+        wake.notify_all();
+        for (std::thread& thread : threads) thread.join();
+    }
+
+    /**
+     * @brief Queues a task, on the calling worker's own queue when called from the pool.
+     */
+    void submit(std::function<void()> task) {
+        task_queue& queue = *queues[current_pool == this ? current_index : queues.size() - 1];
+        {
+            std::lock_guard<std::mutex> lock(queue.mutex);
+            queue.tasks.push_back(std::move(task));
+        }
+        {
+            std::lock_guard<std::mutex> lock(sleep_mutex);
+            ++pending;
+        }
+        wake.notify_one();
+    }
+
+    /**
+     * @brief Runs one queued task on the calling thread, preferring its own queue.
+     *
+     * @return False if no task was available.
+     */
+    bool run_pending_task() {
+        std::function<void()> task;
+        if (!take(task)) return false;
+        task();
+        return true;
+    }
+
+private:
+    struct task_queue {
+        std::mutex mutex;
+        std::deque<std::function<void()>> tasks;
+    };
+
+    std::vector<std::unique_ptr<task_queue>> queues;
+    std::vector<std::thread> threads;
+    std::mutex sleep_mutex;
+    std::condition_variable wake;
+    std::atomic<std::size_t> pending{0};
+    bool stopping = false;
+
+    static inline thread_local thread_pool* current_pool = nullptr;
+    static inline thread_local std::size_t current_index = 0;
+
+    bool take(std::function<void()>& task) {
+        const std::size_t own = current_pool == this ? current_index : queues.size() - 1;
+        for (std::size_t k = 0; k < queues.size(); ++k) {
+            task_queue& queue = *queues[(own + k) % queues.size()];
+            std::lock_guard<std::mutex> lock(queue.mutex);
+            if (queue.tasks.empty()) continue;
+            if (k == 0) {
+                task = std::move(queue.tasks.back());
+                queue.tasks.pop_back();
+            } else {
+                task = std::move(queue.tasks.front());
+                queue.tasks.pop_front();
+            }
+            --pending;
+            return true;
+        }
+        return false;
+    }
+
+    void work(std::size_t index) {
+        current_pool = this;
+        current_index = index;
+        for (;;) {
+            {
+                std::unique_lock<std::mutex> lock(sleep_mutex);
+                wake.wait(lock, [this] { return stopping || pending > 0; });
+                if (stopping) return;
+            }
+            run_pending_task();
+        }
+    }
+};
+
+inline std::unique_ptr<thread_pool> pool;
+
+/**
+ * @brief Decides whether work on operands of the given size should be split across
+ *        the thread pool.
+ */
+inline bool should_fork(std::size_t size) {
+    return pool != nullptr && size >= parallel.grain;
+}
+
+/**
+ * @brief A set of tasks run on the shared pool that can be waited for together.
+ *
+ *        Without an active pool, or when constructed with fork set to false, every task
+ *        runs immediately on the calling thread, which keeps the serial code path free
+ *        of any synchronization. A task runs in the memory scope that was active when it
+ *        was submitted, so its temporaries come from the same resource as its results.
+ *        The first exception thrown by a task is rethrown by wait().
+ */
+class task_group {
+public:
+    explicit task_group(bool fork) : forking(fork && pool != nullptr) {}
+    task_group(const task_group&) = delete;
+    task_group& operator=(const task_group&) = delete;
+
+    ~task_group() {
+        if (remaining > 0) {
+            try {
+                wait();
+            } catch (...) {
+            }
+        }
+    }
+
+    template <typename F>
+    void run(F&& body) {
+        if (!forking) {
+            body();
+            return;
+        }
+        ++remaining;
+        pool->submit([this, resource = scoped_resource, body = std::forward<F>(body)]() mutable {
+            memory_scope scope(resource);
+            try {
+                body();
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(error_mutex);
+                if (!error) error = std::current_exception();
+            }
+            --remaining;
+        });
+    }
+
+    void wait() {
+        while (remaining > 0) {
+            if (!pool->run_pending_task()) std::this_thread::yield();
+        }
+        if (error) std::rethrow_exception(std::exchange(error, nullptr));
+    }
+
+private:
+    const bool forking;
+    std::atomic<std::size_t> remaining{0};
+    std::mutex error_mutex;
+    std::exception_ptr error;
+};
+
+/**
+ * @brief Calls body(begin, end) over consecutive slices of [0, count), in parallel when
+ *        count reaches twice the grain and the pool is active.
+ */
+template <typename F>
+void parallel_for(std::size_t count, F&& body) {
+    if (!should_fork(count / 2)) {
+        body(std::size_t{0}, count);
+        return;
+    }
+    const std::size_t slices = std::min(count / parallel.grain, 4 * parallel.threads);
+    const std::size_t step = (count + slices - 1) / slices;
+    task_group group(true);
+    for (std::size_t begin = step; begin < count; begin += step) {
+        group.run([&body, begin, end = std::min(count, begin + step)] { body(begin, end); });
+    }
+    body(std::size_t{0}, std::min(count, step));
+    group.wait();
+}
+
+/**
+ * @brief Arithmetic modulo one of the primes used by the number-theoretic transform.
+ *
+ *        The primes are of the form c * 2^k + 1 and below 2^62, so that residues fit a
+ *        limb with room to spare and products can be reduced with Montgomery's method
+ *        (R = 2^64) without any hardware division.
+ */
+struct ntt_prime {
+    limb_t p;
+    limb_t neg_inv;
+    limb_t r2;
+    limb_t generator;
+
+    /**
+     * @brief Precomputes the Montgomery constants for a prime and one of its primitive roots.
+     */
+    static ntt_prime make(limb_t p, limb_t generator) {
+        const limb_t r = static_cast<limb_t>((static_cast<dlimb_t>(1) << limb_bits) % p);
+        return {p, limb_t{0} - inverse_limb(p), static_cast<limb_t>(static_cast<dlimb_t>(r) * r % p), generator};
+    }
+
+    /**
+     * @brief Montgomery reduction, returns t / 2^64 mod p for t < p * 2^64.
+     */
+    [[nodiscard]] limb_t reduce(dlimb_t t) const {
+        const limb_t m = static_cast<limb_t>(t) * neg_inv;
+        const limb_t res = static_cast<limb_t>((t + static_cast<dlimb_t>(m) * p) >> limb_bits);
+        return res >= p ? res - p : res;
+    }
+
+    [[nodiscard]] limb_t mul(limb_t a, limb_t b) const { return reduce(static_cast<dlimb_t>(a) * b); }
+    [[nodiscard]] limb_t add(limb_t a, limb_t b) const { const limb_t s = a + b; return s >= p ? s - p : s; }
+    [[nodiscard]] limb_t sub(limb_t a, limb_t b) const { return a >= b ? a - b : a + p - b; }
+    [[nodiscard]] limb_t to_montgomery(limb_t a) const { return mul(a, r2); }
+
+    /**
+     * @brief Reduces a full limb modulo p; as p is close to 2^62 at most four subtractions are needed.
+     */
+    [[nodiscard]] limb_t reduce_limb(limb_t a) const {
+        while (a >= p) a -= p;
+        return a;
+    }
+
+    /**
+     * @brief Raises a value in Montgomery form to a power, keeping it in Montgomery form.
+     */
+    [[nodiscard]] limb_t pow(limb_t base, limb_t exp) const {
+        limb_t result = to_montgomery(1);
+        for (; exp != 0; exp >>= 1) {
+            if (exp & 1) result = mul(result, base);
+            base = mul(base, base);
+        }
+        return result;
+    }
+};
+
+/**
+ * @brief The three NTT primes and their primitive roots. All support transforms of
+ *        up to 2^42 points, and their product exceeds 2^185, which bounds every
+ *        coefficient of a convolution of 64-bit limbs for up to 2^57 points.
+ */
+inline const ntt_prime ntt_primes[3] = {
+    ntt_prime::make(0x3fffc00000000001ULL, 11),
+    ntt_prime::make(0x3fff840000000001ULL, 19),
+    ntt_prime::make(0x3fff540000000001ULL, 5),
+};
+
+/**
+ * @brief Builds the twiddle factor table for a transform of n points.
+ *
+ *        Entry len + j holds w^j, in Montgomery form, where w is a primitive root of
+ *        unity of order 2 * len, for every power of two len below n.
+ *
+ * @param inverse Whether to use the inverse root, for the backward transform.
+ */
+inline scratch_vector<limb_t> ntt_twiddles(const ntt_prime& m, std::size_t n, bool inverse) {
+    scratch_vector<limb_t> table(std::max<std::size_t>(n, 2));
+    limb_t root = m.pow(m.to_montgomery(m.generator), (m.p - 1) / n);
+    if (inverse) root = m.pow(root, m.p - 2);
+    const std::size_t half = n / 2;
+    limb_t w = m.to_montgomery(1);
+    for (std::size_t j = 0; j < half; ++j) {
+        table[half + j] = w;
+        w = m.mul(w, root);
+    }
+    for (std::size_t len = half / 2; len >= 1; len /= 2) {
+        for (std::size_t j = 0; j < len; ++j) table[len + j] = table[2 * len + 2 * j];
+    }
+    return table;
+}
+
+/**
+ * @brief Runs one butterfly stage of a transform of n points, calling body(s, j) for
+ *        the butterfly at offset j of the block starting at s, for blocks of 2 * len
+ *        points. The n / 2 butterflies are independent and split by parallel_for.
+ */
+template <typename F>
+void for_each_butterfly(std::size_t n, std::size_t len, F&& body) {
+    parallel_for(n / 2, [&](std::size_t begin, std::size_t end) {
+        std::size_t s = begin / len * 2 * len;
+        std::size_t j = begin % len;
+        for (std::size_t k = begin; k < end; ++k) {
+            body(s, j);
+            if (++j == len) {
+                j = 0;
+                s += 2 * len;
+            }
+        }
+    });
+}
+
+/**
+ * @brief Forward transform by decimation in frequency; the input is in natural order
+ *        and the output in bit-reversed order.
+ */
+inline void ntt_forward(const ntt_prime& m, limb_t* a, std::size_t n, const limb_t* twiddles) {
+    for (std::size_t len = n / 2; len >= 1; len /= 2) {
+        for_each_butterfly(n, len, [&](std::size_t s, std::size_t j) {
+            const limb_t u = a[s + j];
+            const limb_t v = a[s + j + len];
+            a[s + j] = m.add(u, v);
+            a[s + j + len] = m.mul(m.sub(u, v), twiddles[len + j]);
+        });
+    }
+}
+
+/**
+ * @brief Inverse transform by decimation in time; the input is in bit-reversed order
+ *        and the output, scaled by n, in natural order.
+ */
+inline void ntt_inverse(const ntt_prime& m, limb_t* a, std::size_t n, const limb_t* twiddles) {
+    for (std::size_t len = 1; len < n; len *= 2) {
+        for_each_butterfly(n, len, [&](std::size_t s, std::size_t j) {
+            const limb_t u = a[s + j];
+            const limb_t v = m.mul(a[s + j + len], twiddles[len + j]);
+            a[s + j] = m.add(u, v);
+            a[s + j + len] = m.sub(u, v);
+        });
+    }
+}
+
+/**
+ * @brief Computes the cyclic convolution of a and b modulo one NTT prime.
+ *
+ *        The inputs are reduced into plain residues, transformed, multiplied pointwise
+ *        and transformed back. Because the operands are never converted to Montgomery
+ *        form, the final scaling by R^2 / n also undoes the factor 1/R left by the
+ *        pointwise Montgomery products. A square, where a and b are the same array,
+ *        needs a single forward transform.
+ *
+ * @param out Destination of n residues.
+ * @param n The transform length, a power of two at least an + bn - 1.
+ */
+inline void ntt_convolve(const ntt_prime& m, limb_t* out, std::size_t n,
+                         const limb_t* a, std::size_t an, const limb_t* b, std::size_t bn) {
+    const bool square = a == b && an == bn;
+    std::fill_n(out, n, limb_t{0});
+    for (std::size_t i = 0; i < an; ++i) out[i] = m.reduce_limb(a[i]);
+    // The transform of b and the forward twiddles are freed before the backward
+    // twiddles are built, so that at most two scratch arrays of n limbs are alive.
+    {
+        scratch_vector<limb_t> fb(square ? 0 : n, 0);
+        if (!square) {
+            for (std::size_t i = 0; i < bn; ++i) fb[i] = m.reduce_limb(b[i]);
+        }
+
+        const scratch_vector<limb_t> forward = ntt_twiddles(m, n, false);
+        {
+            task_group group(should_fork(n));
+            group.run([&] { ntt_forward(m, out, n, forward.data()); });
+            if (!square) ntt_forward(m, fb.data(), n, forward.data());
+            group.wait();
+        }
+        const limb_t* other = square ? out : fb.data();
+        parallel_for(n, [&](std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; ++i) out[i] = m.mul(out[i], other[i]);
+        });
+    }
+
+    const scratch_vector<limb_t> backward = ntt_twiddles(m, n, true);
+    ntt_inverse(m, out, n, backward.data());
+    const limb_t n_inv = m.pow(m.to_montgomery(n % m.p), m.p - 2);
+    const limb_t scale = m.mul(n_inv, m.r2);
+    parallel_for(n, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i) out[i] = m.mul(out[i], scale);
+    });
+}
+
+/**
+ * @brief Multiplies two limb arrays with a three-prime number-theoretic transform,
+ *        r = a * b, in O(n log n) limb operations.
+ *
+ *        Every limb is one coefficient of the transform. The convolution is computed
+ *        modulo each of the three primes and the exact coefficients are recovered with
+ *        Garner's form of the Chinese remainder theorem, then summed with carries into
+ *        the result. All arithmetic is exact integer arithmetic.
+ *
+ * @param r Destination of an + bn limbs; must not overlap a or b.
+ */
+inline void mul_ntt(limb_t* r, const limb_t* a, std::size_t an, const limb_t* b, std::size_t bn) {
+    const std::size_t rn = an + bn;
+    const std::size_t n = std::bit_ceil(rn - 1);
+    scratch_vector<limb_t> residues(3 * n);
+    {
+        task_group group(should_fork(bn));
+        for (std::size_t k = 0; k < 3; ++k) {
+            group.run([&, k] { ntt_convolve(ntt_primes[k], residues.data() + k * n, n, a, an, b, bn); });
+        }
+        group.wait();
+    }
+
+    const limb_t p0 = ntt_primes[0].p;
+    const limb_t p1 = ntt_primes[1].p;
+    const limb_t p2 = ntt_primes[2].p;
+    const dlimb_t p0p1 = static_cast<dlimb_t>(p0) * p1;
+    const limb_t p0_inv_p1 = ntt_primes[1].pow(ntt_primes[1].to_montgomery(p0 % p1), p1 - 2);
+    const limb_t p0p1_inv_p2 = ntt_primes[2].pow(ntt_primes[2].to_montgomery(static_cast<limb_t>(p0p1 % p2)), p2 - 2);
+    const limb_t p0p1_lo = static_cast<limb_t>(p0p1);
+    const limb_t p0p1_hi = static_cast<limb_t>(p0p1 >> limb_bits);
+
+    // Coefficient i weighs 2^(64 * i) and is below p0 * p1 * p2 < 2^186, so what it and
+    // the carry leave above limb i fits the two limbs of the carry into limb i + 1.
+    limb_t acc0 = 0, acc1 = 0;
+    for (std::size_t i = 0; i < rn; ++i) {
+        limb_t x0 = 0, x1 = 0, x2 = 0;
+        if (i < n) {
+            const limb_t v0 = residues[i];
+            const limb_t r1 = residues[n + i];
+            const limb_t r2 = residues[2 * n + i];
+            // Montgomery products with a Montgomery-form constant yield plain residues.
+            // low < p0 * p1 < p2 * 2^64, so one reduction and one R^2 product give low mod p2.
+            const limb_t v1 = ntt_primes[1].mul(ntt_primes[1].sub(r1, ntt_primes[1].reduce_limb(v0)), p0_inv_p1);
+            const dlimb_t low = static_cast<dlimb_t>(p0) * v1 + v0;
+            const limb_t low_p2 = ntt_primes[2].mul(ntt_primes[2].reduce(low), ntt_primes[2].r2);
+            const limb_t v2 = ntt_primes[2].mul(ntt_primes[2].sub(r2, low_p2), p0p1_inv_p2);
+
+            const dlimb_t lo_part = static_cast<dlimb_t>(p0p1_lo) * v2;
+            const dlimb_t hi_part = static_cast<dlimb_t>(p0p1_hi) * v2 + static_cast<limb_t>(lo_part >> limb_bits);
+            const dlimb_t sum0 = static_cast<dlimb_t>(static_cast<limb_t>(lo_part)) + static_cast<limb_t>(low);
+            const dlimb_t sum1 = static_cast<dlimb_t>(static_cast<limb_t>(hi_part)) + static_cast<limb_t>(low >> limb_bits)
+                                 + static_cast<limb_t>(sum0 >> limb_bits);
+            x0 = static_cast<limb_t>(sum0);
+            x1 = static_cast<limb_t>(sum1);
+            x2 = static_cast<limb_t>(hi_part >> limb_bits) + static_cast<limb_t>(sum1 >> limb_bits);
+        }
+        const dlimb_t s0 = static_cast<dlimb_t>(acc0) + x0;
+        const dlimb_t s1 = static_cast<dlimb_t>(acc1) + x1 + static_cast<limb_t>(s0 >> limb_bits);
+        r[i] = static_cast<limb_t>(s0);
+        acc0 = static_cast<limb_t>(s1);
+        acc1 = x2 + static_cast<limb_t>(s1 >> limb_bits);
+    }
+}
+
+/**
+ * @brief Growable limb array with inline storage for the first N limbs.
+ *
+ *        Behaves like a minimal std::vector<limb_t>, but keeps up to N limbs inside
+ *        the object itself and only allocates once the size exceeds that. Copying or
+ *        moving a value that fits inline never touches the heap. New limbs created by
+ *        resize are zero-initialized.
+ *
+ *        Heap limbs come from a memory resource fixed at construction: the one of the
+ *        enclosing memory_scope unless given explicitly, and the global heap through
+ *        std::allocator when there is none. As with the std::pmr containers, copies
+ *        take the resource of the scope rather than that of their source, moves keep
+ *        the resource of their source, and assignment between different resources
+ *        copies the limbs.
+ *
+ *        With BIGINT_COPY_ON_WRITE defined, heap limbs carry an atomic reference count
+ *        and copies between vectors of the same resource share them, so copying a long
+ *        value is O(1). Every non-const access detaches a shared vector first, copying
+ *        its limbs, so values still behave as independent. Like std::shared_ptr, two
+ *        vectors sharing limbs may be used from different threads, one vector may not.
+ *
+ * @tparam N Number of limbs stored inline.
+ */
+template <std::size_t N>
+class limb_vector {
+public:
+    static_assert(N > 0, "limb_vector needs at least one inline limb");
+
+    constexpr limb_vector() = default;
+
+    explicit limb_vector(std::pmr::memory_resource* resource) : resource_(heap_or(resource)) {}
+
+    constexpr limb_vector(const limb_vector& other) {
+        if (!share(other)) assign(other.data(), other.size_);
+    }
+
+    constexpr limb_vector(limb_vector&& other) noexcept : resource_(other.resource_) {
+        steal(other);
+    }
+
+    constexpr limb_vector& operator=(const limb_vector& other) {
+        if (this != &other && !share(other)) assign(other.data(), other.size_);
+        return *this;
+    }
+
+    constexpr limb_vector& operator=(limb_vector&& other) {
+        if (this == &other) return *this;
+        if (resource_ == other.resource_) {
+            release();
+            steal(other);
+        } else {
+            assign(other.data(), other.size_);
+        }
+        return *this;
+    }
+
+    constexpr ~limb_vector() {
+        release();
+    }
+
+    [[nodiscard]] constexpr std::size_t size() const { return size_; }
+    [[nodiscard]] constexpr std::size_t capacity() const { return capacity_; }
+    [[nodiscard]] constexpr bool empty() const { return size_ == 0; }
+    [[nodiscard]] constexpr bool is_inline() const { return heap_ == nullptr; }
+
+    /**
+     * @brief Returns the resource the heap limbs come from.
+     */
+    [[nodiscard]] constexpr std::pmr::memory_resource* resource() const {
+        return resource_ ? resource_ : std::pmr::new_delete_resource();
+    }
+
+    [[nodiscard]] constexpr limb_t* data() {
+        unshare();
+        return heap_ ? heap_ : inline_;
+    }
+    [[nodiscard]] constexpr const limb_t* data() const { return heap_ ? heap_ : inline_; }
+
+    constexpr limb_t& operator[](std::size_t i) { return data()[i]; }
+    constexpr const limb_t& operator[](std::size_t i) const { return data()[i]; }
+
+    constexpr limb_t& back() { return data()[size_ - 1]; }
+    [[nodiscard]] constexpr const limb_t& back() const { return data()[size_ - 1]; }
+
+    constexpr limb_t* begin() { return data(); }
+    constexpr limb_t* end() { return data() + size_; }
+    [[nodiscard]] constexpr const limb_t* begin() const { return data(); }
+    [[nodiscard]] constexpr const limb_t* end() const { return data() + size_; }
+
+    /**
+     * @brief Ensures room for at least n limbs, keeping the current contents.
+     */
+    constexpr void reserve(std::size_t n) {
+        if (n <= capacity_) return;
+        limb_t* fresh = allocate(n);
+        std::copy_n(std::as_const(*this).data(), size_, fresh);
+        release();
+        heap_ = fresh;
+        capacity_ = n;
+    }
+
+    /**
+     * @brief Changes the number of limbs, zero-filling any newly exposed limbs.
+     */
+    constexpr void resize(std::size_t n) {
+        if (n > capacity_) reserve(std::max(n, 2 * capacity_));
+        if (n > size_) std::fill(data() + size_, data() + n, limb_t{0});
+        size_ = n;
+    }
+
+    constexpr void push_back(limb_t limb) {
+        if (size_ == capacity_) reserve(2 * capacity_);
+        data()[size_++] = limb;
+    }
+
+    constexpr void pop_back() { --size_; }
+
+    /**
+     * @brief Removes every limb. Shared heap limbs are released rather than copied, so
+     *        the vector is refilled from its inline storage or a buffer of the new size.
+     */
+    constexpr void clear() {
+        size_ = 0;
+        unshare();
+    }
+
+    /**
+     * @brief Replaces the contents with n limbs copied from src.
+     */
+    constexpr void assign(const limb_t* src, std::size_t n) {
+        // Emptied first, so that neither growing nor detaching copies the old limbs.
+        clear();
+        reserve(n);
+        std::copy_n(src, n, data());
+        size_ = n;
+    }
+
+    friend constexpr bool operator==(const limb_vector& lhs, const limb_vector& rhs) {
+        return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+    }
+
+private:
+    std::pmr::memory_resource* resource_ = initial_resource();
+    limb_t* heap_ = nullptr;
+    std::size_t size_ = 0;
+    std::size_t capacity_ = N;
+    limb_t inline_[N] = {};
+
+    /**
+     * @brief The resource of a vector constructed without one: that of the enclosing
+     *        memory_scope, or std::allocator during constant evaluation, where the
+     *        thread-local scope cannot be read.
+     */
+    static constexpr std::pmr::memory_resource* initial_resource() {
+        if consteval {
+            return nullptr;
+        } else {
+            return heap_or(scoped_resource);
+        }
+    }
+
+    /**
+     * @brief Maps the new/delete resource to null, which allocates through std::allocator.
+     */
+    static std::pmr::memory_resource* heap_or(std::pmr::memory_resource* resource) {
+        return resource == std::pmr::new_delete_resource() ? nullptr : resource;
+    }
+
+#ifdef BIGINT_COPY_ON_WRITE
+    using reference_count = std::atomic<std::size_t>;
+    static_assert(sizeof(reference_count) == sizeof(limb_t) && alignof(reference_count) <= alignof(limb_t),
+                  "the reference count must fit in the limb before the heap limbs");
+
+    /**
+     * @brief Number of limbs allocated before the heap limbs for their reference count.
+     *        Constant evaluation never shares limbs, so it allocates none.
+     */
+    static constexpr std::size_t header_limbs() {
+        if consteval {
+            return 0;
+        } else {
+            return 1;
+        }
+    }
+
+    reference_count& references() const {
+        return *std::launder(reinterpret_cast<reference_count*>(heap_ - 1));
+    }
+#else
+    static constexpr std::size_t header_limbs() { return 0; }
+#endif
+
+    /**
+     * @brief Allocates room for n limbs from the resource of the vector.
+     */
+    constexpr limb_t* allocate(std::size_t n) {
+        const std::size_t total = n + header_limbs();
+        limb_t* block = resource_ ? static_cast<limb_t*>(resource_->allocate(total * sizeof(limb_t), alignof(limb_t)))
+                                  : std::allocator<limb_t>().allocate(total);
+        count_allocation(n * sizeof(limb_t));
+#ifdef BIGINT_COPY_ON_WRITE
+        if !consteval {
+            ::new (static_cast<void*>(block)) reference_count(1);
+        }
+#endif
+        return block + header_limbs();
+    }
+
+    /**
+     * @brief Drops this vector's hold on its heap limbs, freeing them if it was the last.
+     */
+    constexpr void release() {
+        if (heap_) {
+#ifdef BIGINT_COPY_ON_WRITE
+            if !consteval {
+                // A count of one cannot be raised by another thread, so the atomic
+                // decrement is only needed for limbs that are shared.
+                if (references().load(std::memory_order_acquire) != 1 &&
+                    references().fetch_sub(1, std::memory_order_acq_rel) != 1) {
+                    heap_ = nullptr;
+                    capacity_ = N;
+                    return;
+                }
+            }
+#endif
+            count_deallocation();
+            const std::size_t total = capacity_ + header_limbs();
+            limb_t* block = heap_ - header_limbs();
+            if (resource_) {
+                resource_->deallocate(block, total * sizeof(limb_t), alignof(limb_t));
+            } else {
+                std::allocator<limb_t>().deallocate(block, total);
+            }
+        }
+        heap_ = nullptr;
+        capacity_ = N;
+    }
+
+    /**
+     * @brief With BIGINT_COPY_ON_WRITE, makes this vector share the heap limbs of other
+     *        when both allocate from the same resource.
+     *
+     * @return Whether the limbs are shared; false when they must be copied.
+     */
+    constexpr bool share([[maybe_unused]] const limb_vector& other) {
+#ifdef BIGINT_COPY_ON_WRITE
+        if !consteval {
+            if (other.heap_ && resource_ == other.resource_) {
+                // Counted before releasing, in case this vector already shares the limbs.
+                other.references().fetch_add(1, std::memory_order_relaxed);
+                release();
+                heap_ = other.heap_;
+                capacity_ = other.capacity_;
+                size_ = other.size_;
+                return true;
+            }
+        }
+#endif
+        return false;
+    }
+
+    /**
+     * @brief With BIGINT_COPY_ON_WRITE, gives this vector its own copy of shared heap
+     *        limbs before they are modified.
+     */
+    constexpr void unshare() {
+#ifdef BIGINT_COPY_ON_WRITE
+        if !consteval {
+            if (heap_ && references().load(std::memory_order_acquire) != 1) [[unlikely]] detach();
+        }
+#endif
+    }
+
+#ifdef BIGINT_COPY_ON_WRITE
+    /**
+     * @brief Replaces shared heap limbs by a copy owned by this vector alone, or just
+     *        drops them when the vector is empty. Kept out of line so that the check in
+     *        every non-const access stays small.
+     */
+    __attribute__((noinline)) void detach() {
+        if (size_ == 0) {
+            release();
+            return;
+        }
+        const std::size_t capacity = capacity_;
+        limb_t* fresh = allocate(capacity);
+        std::copy_n(heap_, size_, fresh);
+        release();
+        heap_ = fresh;
+        capacity_ = capacity;
+    }
+#endif
+
+    constexpr void steal(limb_vector& other) {
+        if (other.heap_) {
+            heap_ = other.heap_;
+            capacity_ = other.capacity_;
+            other.heap_ = nullptr;
+            other.capacity_ = N;
+        } else {
+            std::copy_n(other.inline_, other.size_, inline_);
+        }
+        size_ = other.size_;
+        other.size_ = 0;
+    }
+};
+
+} // namespace bigint_detail
+
+class bigint;
+
+namespace bigint_detail {
+
+/**
+ * @brief Tags naming the operation of an expression node.
+ */
+struct add_op {};
+struct sub_op {};
+struct mul_op {};
+
+template <typename Op, typename L, typename R>
+class bigint_expr;
+
+template <typename T>
+inline constexpr bool is_expr = false;
+
+template <typename Op, typename L, typename R>
+inline constexpr bool is_expr<bigint_expr<Op, L, R>> = true;
+
+template <typename T>
+inline constexpr bool is_product = false;
+
+template <typename L, typename R>
+inline constexpr bool is_product<bigint_expr<mul_op, L, R>> = true;
+
+/**
+ * @brief Operand of +, - or * that builds an expression node: a bigint or another node.
+ */
+template <typename T>
+concept bigint_operand = std::same_as<T, bigint> || is_expr<T>;
+
+/**
+ * @brief Built-in integer type whose magnitude fits into a single limb; bool excluded.
+ */
+template <typename T>
+concept native_integer = std::integral<T> && !std::same_as<T, bool> && sizeof(T) <= sizeof(limb_t);
+
+/**
+ * @brief Lazily evaluated result of +, - or * on bigint operands.
+ *
+ *        bigint leaves are held by reference and nested nodes by value, so a node is a
+ *        couple of pointers and must not outlive the full expression that created it.
+ *        Nothing is computed until the node is converted to or assigned to a bigint,
+ *        which evaluates the whole tree straight into the destination and fuses
+ *        products that are added or subtracted into a single multiply-accumulate.
+ */
+template <typename Op, typename L, typename R>
+class bigint_expr {
+public:
+    using operand_left = std::conditional_t<is_expr<L>, L, const L&>;
+    using operand_right = std::conditional_t<is_expr<R>, R, const R&>;
+
+    constexpr bigint_expr(const L& left, const R& right) : lhs(left), rhs(right) {}
+
+    operand_left lhs;
+    operand_right rhs;
+};
+
+/**
+ * @brief Limbs of an integer literal, sized for the longest value its digits can spell.
+ */
+template <std::size_t N>
+struct literal_limbs {
+    std::array<limb_t, N> limbs{};
+    std::size_t size = 0;
+};
+
+/**
+ * @brief Converts the characters of an integer literal to limbs at compile time.
+ *
+ *        Accepts the forms of the built-in integer literals: decimal, 0x hexadecimal,
+ *        0b binary and 0 octal, with optional ' digit separators.
+ *
+ * @tparam Chars The characters of the literal, as passed to a literal operator template.
+ * @return The magnitude of the literal, least significant limb first.
+ * @throw std::invalid_argument If the literal is not an integer, which fails compilation.
+ */
+template <char... Chars>
+consteval auto parse_literal() {
+    constexpr char text[] = {Chars...};
+    constexpr std::size_t length = sizeof...(Chars);
+    // Every digit carries at most 4 bits.
+    literal_limbs<length / 16 + 1> result;
+    limb_t base = 10;
+    std::size_t pos = 0;
+    if (length > 1 && text[0] == '0') {
+        if (text[1] == 'x' || text[1] == 'X') {
+            base = 16;
+            pos = 2;
+        } else if (text[1] == 'b' || text[1] == 'B') {
+            base = 2;
+            pos = 2;
+        } else {
+            base = 8;
+            pos = 1;
+        }
+    }
+    for (; pos < length; ++pos) {
+        const char c = text[pos];
+        if (c == '\'') continue;
+        limb_t digit = base;
+        if (c >= '0' && c <= '9') {
+            digit = static_cast<limb_t>(c - '0');
+        } else if (c >= 'a' && c <= 'f') {
+            digit = static_cast<limb_t>(c - 'a' + 10);
+        } else if (c >= 'A' && c <= 'F') {
+            digit = static_cast<limb_t>(c - 'A' + 10);
+        }
+        if (digit >= base) throw std::invalid_argument("bigint literal must be an integer");
+        limb_t* r = result.limbs.data();
+        limb_t carry = mul_1(r, r, result.size, base);
+        carry += add_1(r, r, result.size, digit);
+        if (carry != 0) r[result.size++] = carry;
+    }
+    return result;
+}
+
+/**
+ * @brief The limbs of a literal, computed once per distinct literal.
+ */
+template <char... Chars>
+inline constexpr auto literal_value = parse_literal<Chars...>();
+
+} // namespace bigint_detail
+
+/**
+ * @brief Overloads the addition operator for bigint operands.
+ *
+ *        Returns an expression node that is evaluated once it is assigned to or
+ *        converted into a bigint, so chained arithmetic creates no temporaries.
+ *        Expiring bigint operands use the eager rvalue overloads instead.
+ *
+ * @param lhs A bigint or expression to add.
+ * @param rhs A bigint or expression to add.
+ * @return The unevaluated sum.
+ */
+template <bigint_detail::bigint_operand L, bigint_detail::bigint_operand R>
+constexpr bigint_detail::bigint_expr<bigint_detail::add_op, L, R> operator+(const L& lhs, const R& rhs) {
+    return {lhs, rhs};
+}
+
+/**
+ * @brief Overloads the subtraction operator for bigint operands.
+ *
+ * @param lhs The bigint or expression to subtract from.
+ * @param rhs The bigint or expression to subtract.
+ * @return The unevaluated difference.
+ */
+template <bigint_detail::bigint_operand L, bigint_detail::bigint_operand R>
+constexpr bigint_detail::bigint_expr<bigint_detail::sub_op, L, R> operator-(const L& lhs, const R& rhs) {
+    return {lhs, rhs};
+}
+
+/**
+ * @brief Overloads the multiplication operator for bigint operands. When the product
+ *        is added to or subtracted from another term, evaluation fuses the two into
+ *        a single multiply-accumulate.
+ *
+ * @param lhs A bigint or expression factor.
+ * @param rhs A bigint or expression factor.
+ * @return The unevaluated product.
+ */
+template <bigint_detail::bigint_operand L, bigint_detail::bigint_operand R>
+constexpr bigint_detail::bigint_expr<bigint_detail::mul_op, L, R> operator*(const L& lhs, const R& rhs) {
+    return {lhs, rhs};
+}
+
+/**
+ * @brief What the arithmetic of a fixed_int does when a result does not fit its width.
+ */
+enum class overflow_mode {
+    wrap,     ///< Keep the low bits, like the built-in unsigned types.
+    checked,  ///< Throw std::overflow_error.
+};
+
+template <std::size_t Bits, bool Signed, overflow_mode Mode>
+class fixed_int;
+
+/**
+ * @brief Compares the absolute values of the current bigint object
+ *        with another bigint object to determine which is larger.
+ *
+ *        This method considers only the magnitudes of the numbers
+ *        and does not take into account their signs.
+ *
+ * @param value The bigint object to compare against.
+ * @return True if the absolute value of the provided bigint object is larger
+ *         than the absolute value of the current bigint object, otherwise false.
+ */
+class bigint {
+public:
+    using limb_t = bigint_detail::limb_t;
+    using limb_storage = bigint_detail::limb_vector<BIGINT_INLINE_LIMBS>;
+    using allocator_type = std::pmr::polymorphic_allocator<limb_t>;
+    using memory_scope = bigint_detail::memory_scope;
+
+    constexpr bigint() : is_negative(false) {}
+
+    /**
+     * @brief Allocator-extended constructor: constructs a bigint from args exactly as
+     *        the matching constructor would, with its limbs, and the temporaries used
+     *        to build it, allocated from the resource of alloc. std::pmr containers
+     *        construct their bigint elements through it.
+     *
+     * @param alloc Allocator whose resource the new bigint allocates from for its lifetime.
+     * @param args Arguments for one of the other constructors, possibly none.
+     */
+    template <typename... Args>
+    bigint(std::allocator_arg_t, const allocator_type& alloc, Args&&... args)
+        : limbs(alloc.resource()), is_negative(false) {
+        const memory_scope scope(alloc.resource());
+        *this = bigint(std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Constructs a bigint by evaluating an arithmetic expression.
+     *        The expression tree is evaluated directly into the new object.
+     *
+     * @param expr The expression built by +, - or * on bigint operands.
+     */
+    template <typename Op, typename L, typename R>
+    constexpr bigint(const bigint_detail::bigint_expr<Op, L, R>& expr) : is_negative(false) {
+        evaluate(expr);
+    }
+
+    bigint(const bigint&) = default;
+    bigint(bigint&&) noexcept = default;
+    bigint& operator=(const bigint&) = default;
+    bigint& operator=(bigint&&) = default;
+
+    /**
+     * @brief Returns an allocator for the memory resource this bigint allocates from.
+     */
+    [[nodiscard]] allocator_type get_allocator() const {
+        return allocator_type(limbs.resource());
+    }
+
+    /**
+     * @brief Assigns the value of an arithmetic expression, evaluating it into the
+     *        existing storage of this object. If the expression reads this object,
+     *        it is evaluated into a temporary first.
+     *
+     * @param expr The expression built by +, - or * on bigint operands.
+     * @return A reference to this object.
+     */
+    template <typename Op, typename L, typename R>
+    constexpr bigint& operator=(const bigint_detail::bigint_expr<Op, L, R>& expr) {
+        if (refers_to(expr, this)) {
+            bigint result(expr);
+            return *this = std::move(result);
+        }
+        evaluate(expr);
+        return *this;
+    }
+
+    /**
+     * @brief Constructs a bigint object from a built-in integer of any width up to
+     *        64 bits, signed or unsigned. The magnitude of the number fits into a
+     *        single limb, which is stored unless the number is zero. Handles both
+     *        positive and negative numbers, including the minimum int64_t value and
+     *        the full range of uint64_t.
+     *
+     * @param num The number to initialize the bigint object. If the number is
+     *            negative, the bigint will be marked as negative.
+     * @return A bigint object representing the given number.
+     */
+    template <bigint_detail::native_integer T>
+    explicit constexpr bigint(T num) : is_negative(std::cmp_less(num, 0)) {
+        const limb_t magnitude = native_magnitude(num);
+        if (magnitude != 0) limbs.push_back(magnitude);
+    }
+
+    /**
+     * @brief Constructs a bigint object from a string representation of a number.
+     *        Initializes the bigint object based on the input string, which may
+     *        include an optional leading "-" to indicate a negative number.
+     *
+     *        Accepts std::string, string literals and any other text viewable as a
+     *        std::string_view without copying it. Parsing is done by from_chars.
+     *
+     * @param str The string representation of the number to initialize the bigint object with.
+     *            Must contain only digits and an optional leading "-" for negative numbers.
+     *            Leading zeros are handled appropriately, and the result will not maintain
+     *            them in storage.
+     *
+     * @throw std::invalid_argument Throws an exception if the input string is empty
+     *                               or contains invalid (non-digit) characters.
+     */
+    explicit constexpr bigint(std::string_view str) : is_negative(false) {
+        if (str.empty()) throw std::invalid_argument("bigint string is empty");
+        const char* last = str.data() + str.size();
+        const std::from_chars_result result = from_chars(str.data(), last, *this);
+        if (result.ec != std::errc{} || result.ptr != last) {
+            throw std::invalid_argument("bigint string contains non-digit characters");
+        }
+    }
+
+private:
+    /**
+     * @brief Vector of bigint pieces for Toom-Cook, allocated from the current memory_scope.
+     */
+    using bigint_vector = bigint_detail::scratch_vector<bigint>;
+
+    /**
+     * @brief Stores the magnitude of a large integer as binary limbs.
+     *        Each element holds 64 bits of the number in radix 2^64, with
+     *        the least significant limb first. A normalized magnitude has no
+     *        most significant zero limbs, so zero is represented by an empty
+     *        vector. Up to BIGINT_INLINE_LIMBS limbs live inside the object.
+     */
+    limb_storage limbs;
+
+    /**
+     * @brief Boolean flag indicating whether the number is negative.
+     *        Represents the sign of a number, where true denotes a negative
+     *        value and false indicates a non-negative value.
+     */
+    bool is_negative;
+
+    /**
+     * @brief Removes leading zeros from the limbs vector of the bigint object.
+     *        Ensures that the bigint representation is normalized.
+     *
+     *        This method removes any most significant zero limbs. If the resulting
+     *        bigint has a value of zero (i.e., no limbs remain), the is_negative
+     *        flag is set to false to represent a non-negative zero.
+     */
+    constexpr void remove_leading_zeros() {
+        while (!limbs.empty() && limbs.back() == 0) {
+            limbs.pop_back();
+        }
+        if (limbs.empty()) is_negative = false;
+    }
+
+    /**
+     * @brief Replaces the magnitude with magnitude * factor + addend in place.
+     *        Used to fold decimal chunks into the limbs while parsing.
+     *
+     * @param factor The single-limb multiplier.
+     * @param addend The single-limb value added after the multiplication.
+     */
+    constexpr void multiply_add_limb(limb_t factor, limb_t addend) {
+        limb_t carry = bigint_detail::mul_1(limbs.data(), limbs.data(), limbs.size(), factor);
+        for (size_t i = 0; i < limbs.size() && addend != 0; ++i) {
+            limbs[i] += addend;
+            addend = limbs[i] < addend;
+        }
+        carry += addend;
+        if (carry != 0) limbs.push_back(carry);
+    }
+
+    /**
+     * @brief Adds a magnitude to the magnitude of the current bigint in place, keeping the sign.
+     *        Reuses the existing capacity and only grows the limbs when the sum needs it.
+     *
+     * @param b The limbs of the magnitude to add; must not belong to this object.
+     * @param bn The number of limbs in b.
+     */
+    constexpr void add_magnitude(const limb_t* b, size_t bn) {
+        const size_t n = limbs.size();
+        const bigint_detail::operation_timer timer(bigint_detail::operation_kind::add, std::max(n, bn));
+        limb_t carry = 0;
+        if (n >= bn) {
+            carry = bigint_detail::add(limbs.data(), limbs.data(), n, b, bn);
+        } else {
+            limbs.resize(bn);
+            carry = bigint_detail::add(limbs.data(), b, bn, limbs.data(), n);
+        }
+        if (carry != 0) limbs.push_back(carry);
+    }
+
+    /**
+     * @brief Subtracts a magnitude from the magnitude of the current bigint in place.
+     *        When the subtracted magnitude is the larger one, the difference is formed
+     *        the other way round and the sign is flipped.
+     *
+     * @param b The limbs of the magnitude to subtract; must not belong to this object.
+     * @param bn The number of limbs in b.
+     */
+    constexpr void subtract_magnitude(const limb_t* b, size_t bn) {
+        const size_t n = limbs.size();
+        const bigint_detail::operation_timer timer(bigint_detail::operation_kind::subtract, std::max(n, bn));
+        if (bigint_detail::cmp(limbs.data(), n, b, bn) >= 0) {
+            bigint_detail::sub(limbs.data(), limbs.data(), n, b, bn);
+        } else {
+            limbs.resize(bn);
+            bigint_detail::sub(limbs.data(), b, bn, limbs.data(), n);
+            is_negative = !is_negative;
+        }
+        remove_leading_zeros();
+    }
+
+    /**
+     * @brief Adds one to the magnitude in place, stopping as soon as the carry is absorbed.
+     */
+    constexpr void increment_magnitude() {
+        for (limb_t& limb : limbs) {
+            if (++limb != 0) return;
+        }
+        limbs.push_back(1);
+    }
+
+    /**
+     * @brief Subtracts one from a non-zero magnitude in place, stopping as soon as the
+     *        borrow is absorbed.
+     */
+    constexpr void decrement_magnitude() {
+        for (limb_t& limb : limbs) {
+            if (limb-- != 0) break;
+        }
+        remove_leading_zeros();
+    }
+
+    /**
+     * @brief Returns the magnitude of a built-in integer as a limb, exact for every
+     *        value including the minimum of a signed type.
+     */
+    template <bigint_detail::native_integer T>
+    static constexpr limb_t native_magnitude(T value) {
+        const auto limb = static_cast<limb_t>(value);
+        return std::cmp_less(value, 0) ? limb_t{0} - limb : limb;
+    }
+
+    /**
+     * @brief Adds a signed single-limb value in place. The carry or borrow stops at the
+     *        first limb that absorbs it, so the cost is O(1) outside of long runs of
+     *        all-ones or zero limbs.
+     *
+     * @param magnitude The magnitude of the value to add.
+     * @param negative Whether the value to add is negative.
+     */
+    constexpr void add_limb(limb_t magnitude, bool negative) {
+        if (magnitude == 0) return;
+        const bigint_detail::operation_timer timer(bigint_detail::operation_kind::add, limbs.size());
+        if (limbs.empty()) {
+            limbs.push_back(magnitude);
+            is_negative = negative;
+        } else if (is_negative == negative) {
+            if (bigint_detail::add_1(limbs.data(), limbs.data(), limbs.size(), magnitude)) limbs.push_back(1);
+        } else if (limbs.size() > 1 || limbs[0] >= magnitude) {
+            bigint_detail::sub_1(limbs.data(), limbs.data(), limbs.size(), magnitude);
+            remove_leading_zeros();
+        } else {
+            limbs[0] = magnitude - limbs[0];
+            is_negative = negative;
+        }
+    }
+
+    /**
+     * @brief Multiplies in place by a signed single-limb value with one pass of mul_1.
+     */
+    constexpr void multiply_limb(limb_t magnitude, bool negative) {
+        if (magnitude == 0 || limbs.empty()) {
+            limbs.clear();
+            is_negative = false;
+            return;
+        }
+        const bigint_detail::operation_timer timer(bigint_detail::operation_kind::multiply, limbs.size());
+        const limb_t carry = bigint_detail::mul_1(limbs.data(), limbs.data(), limbs.size(), magnitude);
+        if (carry != 0) limbs.push_back(carry);
+        is_negative = is_negative != negative;
+    }
+
+    /**
+     * @brief Replaces the value by its quotient truncated towards zero by a signed
+     *        single-limb divisor, with one pass of hardware division.
+     *
+     * @return The magnitude of the remainder, which takes the sign of the dividend.
+     * @throw std::domain_error Throws an exception if magnitude is zero.
+     */
+    constexpr limb_t divide_limb(limb_t magnitude, bool negative) {
+        if (magnitude == 0) throw std::domain_error("bigint division by zero");
+        const bigint_detail::operation_timer timer(bigint_detail::operation_kind::divide, limbs.size());
+        bigint_detail::count_algorithm(bigint_detail::algorithm_kind::div_1);
+        const limb_t remainder = bigint_detail::divrem_1(limbs.data(), limbs.data(), limbs.size(), magnitude);
+        is_negative = is_negative != negative;
+        remove_leading_zeros();
+        return remainder;
+    }
+
+    /**
+     * @brief Compares the value with a signed single-limb value.
+     */
+    constexpr std::strong_ordering compare_limb(limb_t magnitude, bool negative) const {
+        if (is_negative != negative) {
+            return is_negative ? std::strong_ordering::less : std::strong_ordering::greater;
+        }
+        const std::strong_ordering order = limbs.size() > 1 ? std::strong_ordering::greater
+                                         : limbs.empty()    ? limb_t{0} <=> magnitude
+                                                            : limbs[0] <=> magnitude;
+        return negative ? 0 <=> order : order;
+    }
+
+    /**
+     * @brief Replaces the value with the product x * y, formed directly in the limbs
+     *        of this object with the algorithm chosen by mul_limbs.
+     *
+     * @param x The first factor; must not be this object.
+     * @param y The second factor; must not be this object.
+     */
+    constexpr void assign_product(const bigint& x, const bigint& y) {
+        limbs.clear();
+        is_negative = false;
+        if (x.limbs.empty() || y.limbs.empty()) return;
+        const bool x_longer = x.limbs.size() >= y.limbs.size();
+        const limb_storage& longer = x_longer ? x.limbs : y.limbs;
+        const limb_storage& shorter = x_longer ? y.limbs : x.limbs;
+        const bigint_detail::operation_timer timer(
+            &x == &y ? bigint_detail::operation_kind::square : bigint_detail::operation_kind::multiply, longer.size());
+        limbs.resize(longer.size() + shorter.size());
+        mul_limbs(limbs.data(), longer.data(), longer.size(), shorter.data(), shorter.size());
+        is_negative = x.is_negative != y.is_negative;
+        remove_leading_zeros();
+    }
+
+    /**
+     * @brief Adds or subtracts the product x * y to the value in place.
+     *
+     *        Below the Karatsuba threshold the partial products are accumulated straight
+     *        into the limbs of this object with addmul_1 or submul_1, so no product is
+     *        ever materialized. A difference that turns negative shows up as a borrow
+     *        out of the top limb and is fixed by negating the limbs. Larger products are
+     *        formed in scratch space by mul_limbs and then added in place, except during
+     *        constant evaluation, where scratch space cannot come from a memory resource.
+     *
+     * @param x The first factor; must not be this object.
+     * @param y The second factor; must not be this object.
+     * @param subtract Whether to subtract the product instead of adding it.
+     */
+    constexpr void add_product(const bigint& x, const bigint& y, bool subtract) {
+        if (x.limbs.empty() || y.limbs.empty()) return;
+        const bool product_negative = (x.is_negative != y.is_negative) != subtract;
+        const bool x_longer = x.limbs.size() >= y.limbs.size();
+        const limb_storage& longer = x_longer ? x.limbs : y.limbs;
+        const limb_storage& shorter = x_longer ? y.limbs : x.limbs;
+        const size_t ln = longer.size();
+        const size_t sn = shorter.size();
+        const bigint_detail::operation_timer timer(bigint_detail::operation_kind::multiply, ln);
+
+        if (!std::is_constant_evaluated() && sn >= bigint_detail::tuning.mul_karatsuba) {
+            bigint_detail::scratch_vector<limb_t> product(ln + sn);
+            mul_limbs(product.data(), longer.data(), ln, shorter.data(), sn);
+            size_t pn = product.size();
+            while (pn > 0 && product[pn - 1] == 0) --pn;
+            if (limbs.empty() || product_negative == is_negative) {
+                is_negative = product_negative;
+                add_magnitude(product.data(), pn);
+            } else {
+                subtract_magnitude(product.data(), pn);
+            }
+            return;
+        }
+
+        if (limbs.empty()) is_negative = product_negative;
+        const size_t n = std::max(limbs.size(), ln + sn) + 1;
+        limbs.resize(n);
+        limb_t* r = limbs.data();
+        if (product_negative == is_negative) {
+            for (size_t j = 0; j < sn; ++j) {
+                limb_t carry = bigint_detail::addmul_1(r + j, longer.data(), ln, shorter[j]);
+                for (size_t i = j + ln; carry != 0; ++i) {
+                    r[i] += carry;
+                    carry = r[i] < carry;
+                }
+            }
+        } else {
+            limb_t wrapped = 0;
+            for (size_t j = 0; j < sn; ++j) {
+                limb_t borrow = bigint_detail::submul_1(r + j, longer.data(), ln, shorter[j]);
+                for (size_t i = j + ln; borrow != 0; ++i) {
+                    if (i == n) {
+                        wrapped ^= 1;
+                        break;
+                    }
+                    const limb_t x_i = r[i];
+                    r[i] = x_i - borrow;
+                    borrow = x_i < borrow;
+                }
+            }
+            if (wrapped) {
+                // The limbs hold 2^(64 n) - |difference|; negate them to get the magnitude.
+                limb_t borrow = 0;
+                for (size_t i = 0; i < n; ++i) {
+                    const limb_t limb = r[i];
+                    r[i] = limb_t{0} - limb - borrow;
+                    borrow = (limb | borrow) != 0;
+                }
+                is_negative = !is_negative;
+            }
+        }
+        remove_leading_zeros();
+    }
+
+    /**
+     * @brief Tells whether an expression, or a bigint leaf, reads the given object.
+     */
+    static constexpr bool refers_to(const bigint& value, const bigint* target) {
+        return &value == target;
+    }
+
+    template <typename Op, typename L, typename R>
+    static constexpr bool refers_to(const bigint_detail::bigint_expr<Op, L, R>& expr, const bigint* target) {
+        return refers_to(expr.lhs, target) || refers_to(expr.rhs, target);
+    }
+
+    /**
+     * @brief Yields an operand of an expression as a bigint: leaves are passed through
+     *        by reference and nested expressions are evaluated into a temporary.
+     */
+    static constexpr const bigint& materialize(const bigint& value) {
+        return value;
+    }
+
+    template <typename Op, typename L, typename R>
+    static constexpr bigint materialize(const bigint_detail::bigint_expr<Op, L, R>& expr) {
+        return bigint(expr);
+    }
+
+    /**
+     * @brief Evaluates an expression tree into this object, which none of its leaves
+     *        may refer to.
+     *
+     *        Sums and differences evaluate their left side into this object and then
+     *        add or subtract the right side in place. When either side is a product,
+     *        the other side is evaluated first and the product is accumulated with
+     *        add_product, fusing a * b + c and a * b - c into one pass.
+     */
+    constexpr void evaluate(const bigint& value) {
+        *this = value;
+    }
+
+    template <typename L, typename R>
+    constexpr void evaluate(const bigint_detail::bigint_expr<bigint_detail::mul_op, L, R>& expr) {
+        const auto& x = materialize(expr.lhs);
+        const auto& y = materialize(expr.rhs);
+        assign_product(x, y);
+    }
+
+    template <typename L, typename R>
+    constexpr void evaluate(const bigint_detail::bigint_expr<bigint_detail::add_op, L, R>& expr) {
+        if constexpr (bigint_detail::is_product<R>) {
+            evaluate(expr.lhs);
+            accumulate(expr.rhs, false);
+        } else if constexpr (bigint_detail::is_product<L>) {
+            evaluate(expr.rhs);
+            accumulate(expr.lhs, false);
+        } else {
+            evaluate(expr.lhs);
+            *this += materialize(expr.rhs);
+        }
+    }
+
+    template <typename L, typename R>
+    constexpr void evaluate(const bigint_detail::bigint_expr<bigint_detail::sub_op, L, R>& expr) {
+        if constexpr (bigint_detail::is_product<R>) {
+            evaluate(expr.lhs);
+            accumulate(expr.rhs, true);
+        } else if constexpr (bigint_detail::is_product<L>) {
+            evaluate(expr.rhs);
+            if (!limbs.empty()) is_negative = !is_negative;
+            accumulate(expr.lhs, false);
+        } else {
+            evaluate(expr.lhs);
+            *this -= materialize(expr.rhs);
+        }
+    }
+
+    /**
+     * @brief Adds or subtracts the value of a product node in place.
+     */
+    template <typename L, typename R>
+    constexpr void accumulate(const bigint_detail::bigint_expr<bigint_detail::mul_op, L, R>& product, bool subtract) {
+        const auto& x = materialize(product.lhs);
+        const auto& y = materialize(product.rhs);
+        add_product(x, y, subtract);
+    }
+
+    /**
+     * @brief Builds a non-negative bigint from a limb array, normalizing it.
+     *
+     * @param src The limbs, least significant first.
+     * @param n The number of limbs to copy.
+     * @return The bigint holding the magnitude of the limbs.
+     */
+    static constexpr bigint from_limbs(const limb_t* src, size_t n) {
+        bigint result;
+        while (n > 0 && src[n - 1] == 0) --n;
+        result.limbs.assign(src, n);
+        return result;
+    }
+
+    template <char... Chars>
+    friend constexpr bigint operator""_big();
+
+    template <std::size_t Bits, bool Signed, overflow_mode Mode>
+    friend class fixed_int;
+
+    /**
+     * @brief Shifts the magnitude left by a number of bits in place, keeping the sign.
+     *
+     * @param bits The number of bits to shift by.
+     */
+    void shift_left_bits(size_t bits) {
+        if (limbs.empty() || bits == 0) return;
+        const size_t whole = bits / bigint_detail::limb_bits;
+        const auto rest = static_cast<unsigned>(bits % bigint_detail::limb_bits);
+        if (rest != 0) {
+            const limb_t out = bigint_detail::lshift(limbs.data(), limbs.data(), limbs.size(), rest);
+            if (out != 0) limbs.push_back(out);
+        }
+        if (whole != 0) {
+            const size_t n = limbs.size();
+            limbs.resize(n + whole);
+            std::copy_backward(limbs.data(), limbs.data() + n, limbs.data() + n + whole);
+            std::fill_n(limbs.data(), whole, limb_t{0});
+        }
+    }
+
+    /**
+     * @brief Divides the magnitude in place by a small constant that is known to divide it,
+     *        keeping the sign. Used by the Toom-Cook interpolation steps.
+     *
+     * @param divisor The exact divisor; any power-of-two factor is removed by shifting.
+     */
+    void divide_exact(limb_t divisor) {
+        if (limbs.empty()) return;
+        const auto twos = static_cast<unsigned>(std::countr_zero(divisor));
+        if (twos != 0) {
+            bigint_detail::rshift(limbs.data(), limbs.data(), limbs.size(), twos);
+            divisor >>= twos;
+        }
+        if (divisor != 1) bigint_detail::divexact_1(limbs.data(), limbs.data(), limbs.size(), divisor);
+        remove_leading_zeros();
+    }
+
+    /**
+     * @brief Adds a limb array into a longer one at a limb offset, propagating the carry.
+     *
+     * @param r The accumulator of rn limbs.
+     * @param rn The number of limbs in r; the sum must fit.
+     * @param offset The limb position at which src is added.
+     * @param src The limbs to add.
+     * @param n The number of limbs in src.
+     */
+    static void add_at(limb_t* r, size_t rn, size_t offset, const limb_t* src, size_t n) {
+        if (n == 0) return;
+        limb_t carry = bigint_detail::add(r + offset, r + offset, n, src, n);
+        for (size_t i = offset + n; carry != 0 && i < rn; ++i) {
+            r[i] += carry;
+            carry = r[i] < carry;
+        }
+    }
+
+    /**
+     * @brief Multiplies two limb arrays, choosing the algorithm by operand size.
+     *
+     *        Operands whose shorter side is below the Karatsuba threshold use the
+     *        schoolbook kernel. Strongly unbalanced operands are cut into pieces the
+     *        size of the shorter one, and balanced operands go to Karatsuba, Toom-3 or
+     *        Toom-4 according to bigint::tuning(). Above the NTT threshold the transform
+     *        handles any shape directly. When a and b are the same array every tier
+     *        squares instead, and the sub-products of a square are squares in turn.
+     *        Squares leave the squaring kernel at their own sqr_karatsuba threshold.
+     *        During constant evaluation every product uses the schoolbook kernel.
+     *
+     * @param r Destination of an + bn limbs; must not overlap a or b.
+     * @param a The longer operand, of an limbs.
+     * @param b The shorter operand, of bn limbs, with 0 < bn <= an.
+     */
+    static constexpr void mul_limbs(limb_t* r, const limb_t* a, size_t an, const limb_t* b, size_t bn) {
+        if consteval {
+            bigint_detail::mul_basecase(r, a, an, b, bn);
+            return;
+        }
+        // The recursive algorithms only make progress above a few limbs, whatever the tuning says.
+        const bigint_detail::tuning_parameters& tuning = bigint_detail::tuning;
+        const bool square = a == b && an == bn;
+        if (bn < std::max<size_t>(square ? tuning.sqr_karatsuba : tuning.mul_karatsuba, 4)) {
+            if (square) {
+                bigint_detail::count_algorithm(bigint_detail::algorithm_kind::sqr_basecase);
+                bigint_detail::sqr_basecase(r, a, an);
+            } else {
+                bigint_detail::count_algorithm(bigint_detail::algorithm_kind::mul_basecase);
+                bigint_detail::mul_basecase(r, a, an, b, bn);
+            }
+        } else if (bn >= tuning.mul_ntt) {
+            bigint_detail::count_algorithm(bigint_detail::algorithm_kind::ntt);
+            bigint_detail::mul_ntt(r, a, an, b, bn);
+        } else if (an >= 2 * bn) {
+            bigint_detail::count_algorithm(bigint_detail::algorithm_kind::mul_unbalanced);
+            mul_unbalanced(r, a, an, b, bn);
+        } else if (bn < std::max<size_t>(tuning.mul_toom3, 8)) {
+            bigint_detail::count_algorithm(bigint_detail::algorithm_kind::karatsuba);
+            mul_karatsuba(r, a, an, b, bn);
+        } else if (bn < std::max<size_t>(tuning.mul_toom4, 12)) {
+            bigint_detail::count_algorithm(bigint_detail::algorithm_kind::toom3);
+            mul_toom3(r, a, an, b, bn);
+        } else {
+            bigint_detail::count_algorithm(bigint_detail::algorithm_kind::toom4);
+            mul_toom4(r, a, an, b, bn);
+        }
+    }
+
+    /**
+     * @brief Multiplies two limb arrays of any order and length, including empty ones.
+     *        Used for the sub-products of the recursive algorithms.
+     *
+     * @param r Destination of an + bn limbs; must not overlap a or b.
+     */
+    static void mul_any(limb_t* r, const limb_t* a, size_t an, const limb_t* b, size_t bn) {
+        if (an == 0 || bn == 0) {
+            std::fill_n(r, an + bn, limb_t{0});
+        } else if (an >= bn) {
+            mul_limbs(r, a, an, b, bn);
+        } else {
+            mul_limbs(r, b, bn, a, an);
+        }
+    }
+
+    /**
+     * @brief Multiplies an operand at least twice as long as the other by cutting it into
+     *        pieces of the shorter length, so that each partial product is balanced.
+     *
+     * @param r Destination of an + bn limbs; must not overlap a or b.
+     */
+    static void mul_unbalanced(limb_t* r, const limb_t* a, size_t an, const limb_t* b, size_t bn) {
+        const size_t rn = an + bn;
+        const size_t pieces = (an + bn - 1) / bn;
+        const bool fork = bigint_detail::should_fork(bn);
+        bigint_detail::scratch_vector<limb_t> partials(fork ? (pieces - 1) * 2 * bn : 2 * bn);
+        bigint_detail::task_group group(fork);
+        for (size_t i = 1; fork && i < pieces; ++i) {
+            group.run([=, &partials] {
+                const size_t offset = i * bn;
+                mul_any(partials.data() + (i - 1) * 2 * bn, a + offset, std::min(bn, an - offset), b, bn);
+            });
+        }
+        mul_limbs(r, a, bn, b, bn);
+        std::fill(r + 2 * bn, r + rn, limb_t{0});
+        group.wait();
+        for (size_t i = 1; i < pieces; ++i) {
+            const size_t offset = i * bn;
+            const size_t piece = std::min(bn, an - offset);
+            limb_t* partial = partials.data() + (fork ? (i - 1) * 2 * bn : 0);
+            if (!fork) mul_any(partial, a + offset, piece, b, bn);
+            add_at(r, rn, offset, partial, piece + bn);
+        }
+    }
+
+    /**
+     * @brief Karatsuba multiplication of two limb arrays with bn <= an < 2 * bn.
+     *
+     *        Splits both operands at m = ceil(an / 2) limbs and forms the product from
+     *        three half-size products: a0 * b0, a1 * b1 and (a0 + a1) * (b0 + b1).
+     *
+     * @param r Destination of an + bn limbs; must not overlap a or b.
+     */
+    static void mul_karatsuba(limb_t* r, const limb_t* a, size_t an, const limb_t* b, size_t bn) {
+        const size_t m = (an + 1) / 2;
+        const size_t rn = an + bn;
+        if (bn <= m) {
+            mul_unbalanced(r, a, an, b, bn);
+            return;
+        }
+        const size_t a1n = an - m;
+        const size_t b1n = bn - m;
+
+        bigint_detail::task_group group(bigint_detail::should_fork(m));
+        group.run([=] { mul_any(r, a, m, b, m); });
+        group.run([=] { mul_any(r + 2 * m, a + m, a1n, b + m, b1n); });
+
+        bigint_detail::scratch_vector<limb_t> scratch(4 * m + 4);
+        limb_t* sa = scratch.data();
+        limb_t* sb = sa + m + 1;
+        limb_t* mid = sb + m + 1;
+        sa[m] = bigint_detail::add(sa, a, m, a + m, a1n);
+        if (a == b && an == bn) {
+            sb = sa;
+        } else {
+            sb[m] = bigint_detail::add(sb, b, m, b + m, b1n);
+        }
+        mul_any(mid, sa, m + 1, sb, m + 1);
+        group.wait();
+
+        const size_t mn = 2 * m + 2;
+        bigint_detail::sub(mid, mid, mn, r, 2 * m);
+        bigint_detail::sub(mid, mid, mn, r + 2 * m, a1n + b1n);
+        size_t used = mn;
+        while (used > 0 && mid[used - 1] == 0) --used;
+        add_at(r, rn, m, mid, used);
+    }
+
+    /**
+     * @brief Writes the coefficients of an evaluated product polynomial back into limbs,
+     *        r = sum of coefficients[i] * 2^(64 * i * k).
+     *
+     * @param r Destination of rn limbs; must be large enough for the product.
+     * @param coefficients The non-negative interpolated coefficients.
+     * @param k The piece size, in limbs, the operands were split at.
+     */
+    static void recompose(limb_t* r, size_t rn, const bigint_vector& coefficients, size_t k) {
+        std::fill_n(r, rn, limb_t{0});
+        for (size_t i = 0; i < coefficients.size(); ++i) {
+            const limb_storage& c = coefficients[i].limbs;
+            add_at(r, rn, i * k, c.data(), c.size());
+        }
+    }
+
+    /**
+     * @brief Splits a limb array into pieces of k limbs, the last one possibly shorter or empty.
+     *
+     * @param src The limb array to split.
+     * @param n The number of limbs in src.
+     * @param k The piece size in limbs.
+     * @param count The number of pieces to produce.
+     * @return The pieces as non-negative bigints, least significant first.
+     */
+    static bigint_vector split(const limb_t* src, size_t n, size_t k, size_t count) {
+        bigint_vector pieces;
+        pieces.reserve(count);
+        for (size_t i = 0; i < count; ++i) {
+            const size_t begin = std::min(n, i * k);
+            const size_t end = i + 1 == count ? n : std::min(n, begin + k);
+            pieces.push_back(from_limbs(src + begin, end - begin));
+        }
+        return pieces;
+    }
+
+    /**
+     * @brief Multiplies two lists of evaluated operands element by element, the
+     *        Toom-Cook point products, spreading them over the thread pool when
+     *        the pieces are at least the parallel grain. Passing the same list twice
+     *        squares each value.
+     *
+     * @param pa The values of the first operand at the evaluation points.
+     * @param pb The values of the second operand at the same points.
+     * @param k The piece size in limbs.
+     * @return The products pa[i] * pb[i].
+     */
+    static bigint_vector multiply_points(const bigint_vector& pa, const bigint_vector& pb, size_t k) {
+        bigint_vector products(pa.size());
+        bigint_detail::task_group group(bigint_detail::should_fork(k));
+        for (size_t i = 1; i < pa.size(); ++i) {
+            group.run([&, i] { products[i] = pa[i] * pb[i]; });
+        }
+        products[0] = pa[0] * pb[0];
+        group.wait();
+        return products;
+    }
+
+    /**
+     * @brief Evaluates a three-piece operand at the Toom-3 points 0, 1, -1, -2 and infinity.
+     */
+    static bigint_vector evaluate_toom3(const bigint_vector& p) {
+        const bigint even = p[0] + p[2];
+        const bigint m1 = even - p[1];
+        bigint m2 = m1 + p[2];
+        m2.shift_left_bits(1);
+        m2 = m2 - p[0];
+        return {p[0], even + p[1], m1, m2, p[2]};
+    }
+
+    /**
+     * @brief Toom-3 multiplication of two limb arrays with bn <= an < 2 * bn.
+     *
+     *        Splits both operands into three pieces, multiplies their values at
+     *        0, 1, -1, -2 and infinity and interpolates with Bodrato's sequence.
+     *
+     * @param r Destination of an + bn limbs; must not overlap a or b.
+     */
+    static void mul_toom3(limb_t* r, const limb_t* a, size_t an, const limb_t* b, size_t bn) {
+        const size_t k = (an + 2) / 3;
+        const bigint_vector pa = evaluate_toom3(split(a, an, k, 3));
+        bigint_vector pb_values;
+        if (a != b || an != bn) pb_values = evaluate_toom3(split(b, bn, k, 3));
+        const bigint_vector& pb = pb_values.empty() ? pa : pb_values;
+
+        bigint_vector products = multiply_points(pa, pb, k);
+        const bigint& r0 = products[0];
+        bigint r1 = std::move(products[1]);
+        const bigint& rm1 = products[2];
+        const bigint& rm2 = products[3];
+        const bigint& r4 = products[4];
+
+        bigint r3 = rm2 - r1;
+        r3.divide_exact(3);
+        r1 = r1 - rm1;
+        r1.divide_exact(2);
+        bigint r2 = rm1 - r0;
+        r3 = r2 - r3;
+        r3.divide_exact(2);
+        bigint twice_r4 = r4;
+        twice_r4.shift_left_bits(1);
+        r3 = r3 + twice_r4;
+        r2 = r2 + r1 - r4;
+        r1 = r1 - r3;
+
+        recompose(r, an + bn, {r0, r1, r2, r3, r4}, k);
+    }
+
+    /**
+     * @brief Evaluates a four-piece operand at the Toom-4 points 0, 1, -1, 2, -2, 1/2 and
+     *        infinity; the value at 1/2 is scaled by 8 to stay integral.
+     */
+    static bigint_vector evaluate_toom4(const bigint_vector& p) {
+        const bigint even = p[0] + p[2];
+        const bigint odd = p[1] + p[3];
+        bigint four_p2 = p[2];
+        four_p2.shift_left_bits(2);
+        bigint eight_p3 = p[3];
+        eight_p3.shift_left_bits(3);
+        bigint two_p1 = p[1];
+        two_p1.shift_left_bits(1);
+        const bigint even2 = p[0] + four_p2;
+        const bigint odd2 = two_p1 + eight_p3;
+
+        bigint half = p[0];
+        half.shift_left_bits(1);
+        half = half + p[1];
+        half.shift_left_bits(1);
+        half = half + p[2];
+        half.shift_left_bits(1);
+        half = half + p[3];
+        return {p[0], even + odd, even - odd, even2 + odd2, even2 - odd2, half, p[3]};
+    }
+
+    /**
+     * @brief Toom-4 multiplication of two limb arrays with bn <= an < 2 * bn.
+     *
+     *        Splits both operands into four pieces, multiplies their values at
+     *        0, 1, -1, 2, -2, 1/2 and infinity and solves for the seven coefficients
+     *        by separating the even and odd parts of the product polynomial.
+     *
+     * @param r Destination of an + bn limbs; must not overlap a or b.
+     */
+    static void mul_toom4(limb_t* r, const limb_t* a, size_t an, const limb_t* b, size_t bn) {
+        const size_t k = (an + 3) / 4;
+        const bigint_vector pa = evaluate_toom4(split(a, an, k, 4));
+        bigint_vector pb_values;
+        if (a != b || an != bn) pb_values = evaluate_toom4(split(b, bn, k, 4));
+        const bigint_vector& pb = pb_values.empty() ? pa : pb_values;
+
+        const bigint_vector products = multiply_points(pa, pb, k);
+        const bigint& r0 = products[0];
+        const bigint& v1 = products[1];
+        const bigint& vm1 = products[2];
+        const bigint& v2 = products[3];
+        const bigint& vm2 = products[4];
+        const bigint& vh = products[5];
+        const bigint& r6 = products[6];
+
+        // Even coefficients: r0 + r2 + r4 + r6 and r0 + 4 r2 + 16 r4 + 64 r6.
+        bigint e1 = v1 + vm1;
+        e1.divide_exact(2);
+        e1 = e1 - r0 - r6;
+        bigint e2 = v2 + vm2;
+        e2.divide_exact(2);
+        bigint r6_64 = r6;
+        r6_64.shift_left_bits(6);
+        e2 = e2 - r0 - r6_64;
+        e2.divide_exact(4);
+        bigint r4 = e2 - e1;
+        r4.divide_exact(3);
+        const bigint r2 = e1 - r4;
+
+        // Odd coefficients: r1 + r3 + r5, r1 + 4 r3 + 16 r5 and 16 r1 + 4 r3 + r5.
+        bigint o1 = v1 - vm1;
+        o1.divide_exact(2);
+        bigint o2 = v2 - vm2;
+        o2.divide_exact(4);
+        bigint r0_64 = r0;
+        r0_64.shift_left_bits(6);
+        bigint r2_16 = r2;
+        r2_16.shift_left_bits(4);
+        bigint r4_4 = r4;
+        r4_4.shift_left_bits(2);
+        bigint h = vh - r0_64 - r2_16 - r4_4 - r6;
+        h.divide_exact(2);
+
+        bigint u = h - o1;
+        u.divide_exact(3);
+        bigint v = o2 - o1;
+        v.divide_exact(3);
+        bigint five_o1 = o1;
+        five_o1.shift_left_bits(2);
+        five_o1 = five_o1 + o1;
+        bigint four_u = u;
+        four_u.shift_left_bits(2);
+        bigint r1 = four_u + v - five_o1;
+        r1.divide_exact(15);
+        bigint five_r1 = r1;
+        five_r1.shift_left_bits(2);
+        five_r1 = five_r1 + r1;
+        const bigint r3 = u - five_r1;
+        const bigint r5 = o1 - r1 - r3;
+
+        recompose(r, an + bn, {r0, r1, r2, r3, r4, r5, r6}, k);
+    }
+
+    /**
+     * @brief Smallest divisor size, in limbs, for which division recurses. The basecase
+     *        kernel needs two divisor limbs, so each half of a split divisor must have two.
+     */
+    static size_t div_threshold() {
+        return std::max<size_t>(bigint_detail::tuning.div_burnikel_ziegler, 4);
+    }
+
+    /**
+     * @brief Divides 2 * dn limbs by a normalized divisor of dn limbs, recursively when
+     *        dn reaches the Burnikel-Ziegler threshold and by algorithm D otherwise.
+     *
+     *        The divisor is split into a high half of hi limbs and a low half of lo limbs.
+     *        Each half of the quotient is estimated by dividing the top of the running
+     *        remainder by the high half of the divisor, then corrected by subtracting its
+     *        product with the low half, so the work is dominated by two multiplications
+     *        of half size.
+     *
+     * @param q Destination of dn limbs for the quotient, below the returned limb.
+     * @param n The dividend of 2 * dn limbs; overwritten with the remainder in its low dn limbs.
+     * @param d The divisor of dn limbs, with the top bit of d[dn - 1] set.
+     * @param scratch Temporary storage of dn limbs.
+     * @return The most significant quotient limb, 0 or 1.
+     */
+    static limb_t div_qr_n(limb_t* q, limb_t* n, const limb_t* d, size_t dn, limb_t* scratch) {
+        if (dn < div_threshold()) return bigint_detail::divrem_basecase(q, n, 2 * dn, d, dn);
+        const limb_t one = 1;
+        const size_t lo = dn / 2;
+        const size_t hi = dn - lo;
+
+        limb_t qh = div_qr_n(q + lo, n + 2 * lo, d + lo, hi, scratch);
+        mul_any(scratch, q + lo, hi, d, lo);
+        limb_t borrow = bigint_detail::sub(n + lo, n + lo, dn, scratch, dn);
+        if (qh) borrow += bigint_detail::sub(n + dn, n + dn, lo, d, lo);
+        while (borrow) {
+            qh -= bigint_detail::sub(q + lo, q + lo, hi, &one, 1);
+            borrow -= bigint_detail::add(n + lo, n + lo, dn, d, dn);
+        }
+
+        const limb_t ql = div_qr_n(q, n + hi, d + hi, lo, scratch);
+        mul_any(scratch, d, hi, q, lo);
+        borrow = bigint_detail::sub(n, n, dn, scratch, dn);
+        if (ql) borrow += bigint_detail::sub(n + lo, n + lo, hi, d, hi);
+        while (borrow) {
+            bigint_detail::sub(q, q, lo, &one, 1);
+            borrow -= bigint_detail::add(n, n, dn, d, dn);
+        }
+        return qh;
+    }
+
+    /**
+     * @brief Divides a limb array by a normalized divisor of at least two limbs.
+     *
+     *        Small divisors or quotients use algorithm D directly. Otherwise the
+     *        dividend is consumed from the top in blocks of dn limbs, each divided by
+     *        div_qr_n; a leading partial block is padded to full size unless it is
+     *        small enough for algorithm D.
+     *
+     * @param q Destination of nn - dn + 1 limbs for the quotient.
+     * @param n The dividend of nn >= dn limbs; overwritten with the remainder in its low dn limbs.
+     * @param d The divisor of dn >= 2 limbs, with the top bit of d[dn - 1] set.
+     */
+    static void div_qr(limb_t* q, limb_t* n, size_t nn, const limb_t* d, size_t dn) {
+        const size_t qn = nn - dn;
+        if (dn < div_threshold() || qn < div_threshold()) {
+            bigint_detail::count_algorithm(bigint_detail::algorithm_kind::div_basecase);
+            q[qn] = bigint_detail::divrem_basecase(q, n, nn, d, dn);
+            return;
+        }
+        bigint_detail::count_algorithm(bigint_detail::algorithm_kind::div_burnikel_ziegler);
+        q[qn] = bigint_detail::cmp(n + qn, dn, d, dn) >= 0;
+        if (q[qn]) bigint_detail::sub(n + qn, n + qn, dn, d, dn);
+
+        bigint_detail::scratch_vector<limb_t> scratch(dn);
+        bigint_detail::scratch_vector<limb_t> block;
+        for (size_t pos = qn; pos > 0;) {
+            const size_t count = pos % dn == 0 ? dn : pos % dn;
+            pos -= count;
+            if (count == dn) {
+                div_qr_n(q + pos, n + pos, d, dn, scratch.data());
+            } else if (count < div_threshold()) {
+                bigint_detail::divrem_basecase(q + pos, n + pos, dn + count, d, dn);
+            } else {
+                // Zero padding keeps the top half below the divisor, so the quotient
+                // fits in count limbs and the leading quotient limb is zero.
+                block.assign(3 * dn, 0);
+                std::copy_n(n + pos, dn + count, block.data());
+                div_qr_n(block.data() + 2 * dn, block.data(), d, dn, scratch.data());
+                std::copy_n(block.data() + 2 * dn, count, q + pos);
+                std::copy_n(block.data(), dn, n + pos);
+            }
+        }
+    }
+
+    /**
+     * @brief Computes the truncated quotient and the remainder of a / b.
+     *
+     *        The divisor is shifted so that its top bit is set, which the quotient
+     *        estimates of algorithm D rely on, and the remainder is shifted back.
+     *        The quotient is rounded towards zero and the remainder takes the sign of
+     *        the dividend, as for the built-in integer types.
+     *
+     * @param quotient Receives a / b unless null; may be the same object as a or b.
+     * @param remainder Receives a % b unless null; may be the same object as a or b.
+     * @throw std::domain_error Throws an exception if b is zero.
+     */
+    static void divide(const bigint& a, const bigint& b, bigint* quotient, bigint* remainder) {
+        if (b.limbs.size() == 0) throw std::domain_error("bigint division by zero");
+        const size_t an = a.limbs.size();
+        const size_t bn = b.limbs.size();
+        const bigint_detail::operation_timer timer(bigint_detail::operation_kind::divide, an);
+        if (bigint_detail::cmp(a.limbs.data(), an, b.limbs.data(), bn) < 0) {
+            if (remainder && remainder != &a) *remainder = a;
+            if (quotient) *quotient = bigint();
+            return;
+        }
+
+        bigint q, r;
+        if (bn == 1) {
+            bigint_detail::count_algorithm(bigint_detail::algorithm_kind::div_1);
+            q.limbs.resize(an);
+            const limb_t rem = bigint_detail::divrem_1(q.limbs.data(), a.limbs.data(), an, b.limbs[0]);
+            if (rem != 0) r.limbs.push_back(rem);
+        } else {
+            const unsigned shift = static_cast<unsigned>(std::countl_zero(b.limbs.back()));
+            limb_storage d;
+            d.resize(bn);
+            q.limbs.resize(an - bn + 2);
+            r.limbs.resize(an + 1);
+            if (shift != 0) {
+                bigint_detail::lshift(d.data(), b.limbs.data(), bn, shift);
+                r.limbs[an] = bigint_detail::lshift(r.limbs.data(), a.limbs.data(), an, shift);
+            } else {
+                std::copy_n(b.limbs.data(), bn, d.data());
+                std::copy_n(a.limbs.data(), an, r.limbs.data());
+            }
+            div_qr(q.limbs.data(), r.limbs.data(), an + 1, d.data(), bn);
+            r.limbs.resize(bn);
+            if (shift != 0) bigint_detail::rshift(r.limbs.data(), r.limbs.data(), bn, shift);
+        }
+        q.remove_leading_zeros();
+        r.remove_leading_zeros();
+        q.is_negative = a.is_negative != b.is_negative && !q.limbs.empty();
+        r.is_negative = a.is_negative && !r.limbs.empty();
+        if (quotient) *quotient = std::move(q);
+        if (remainder) *remainder = std::move(r);
+    }
+
+    /**
+     * @brief Returns 10^(19 * 2^k), the k-th power in the table used by decimal conversion.
+     *
+     *        Each entry is the square of the previous one. The table is shared by all
+     *        threads, grows on demand and never shrinks, and entries keep their address.
+     *        It lives on the global heap whatever memory_scope is active.
+     */
+    static const bigint& decimal_power(size_t k) {
+        static std::mutex mutex;
+        static std::deque<bigint> powers;
+        const std::lock_guard<std::mutex> lock(mutex);
+        const memory_scope heap(nullptr);
+        if (powers.empty()) {
+            powers.emplace_back();
+            powers.back().limbs.push_back(bigint_detail::decimal_chunk);
+        }
+        while (powers.size() <= k) {
+            const bigint& last = powers.back();
+            powers.push_back(last * last);
+        }
+        return powers[k];
+    }
+
+    /**
+     * @brief Returns floor(2^(128 * m) / 10^(19 * 2^k)), where m is the limb count of
+     *        that power: the reciprocal with which divide_by_power replaces division by
+     *        two multiplications. Cached like the powers themselves.
+     */
+    static const bigint& decimal_inverse(size_t k) {
+        static std::mutex mutex;
+        static std::deque<bigint> inverses;
+        const std::lock_guard<std::mutex> lock(mutex);
+        const memory_scope heap(nullptr);
+        while (inverses.size() <= k) {
+            const bigint& divisor = decimal_power(inverses.size());
+            bigint numerator;
+            numerator.limbs.resize(2 * divisor.limbs.size() + 1);
+            numerator.limbs.back() = 1;
+            inverses.push_back(numerator / divisor);
+        }
+        return inverses[k];
+    }
+
+    /**
+     * @brief Divides a magnitude by the table power 10^(19 * 2^k), giving non-negative
+     *        results.
+     *
+     *        Small powers use ordinary division. Larger ones use Barrett reduction with
+     *        the cached reciprocal: the dividend is consumed from the top in windows of
+     *        at most 2 * m limbs, m being the size of the power, and each window's
+     *        quotient is estimated by one multiplication, at most two short of exact.
+     *        Dividing repeatedly by the same few powers, as printing does, so costs two
+     *        multiplications per window instead of a full division.
+     *
+     * @param quotient Receives the quotient; must not be a.
+     * @param remainder Receives the remainder; must not be a.
+     */
+    static void divide_by_power(const bigint& a, size_t k, bigint& quotient, bigint& remainder) {
+        const bigint& power = decimal_power(k);
+        const size_t m = power.limbs.size();
+        if (m < div_threshold()) {
+            divide(a, power, &quotient, &remainder);
+            quotient.is_negative = false;
+            remainder.is_negative = false;
+            return;
+        }
+        const bigint& inverse = decimal_inverse(k);
+        const size_t n = a.limbs.size();
+        remainder = a;
+        remainder.is_negative = false;
+        quotient = bigint();
+        if (n < m) return;
+        quotient.limbs.resize(n - m + 1);
+        // Invariant: remainder < power * 2^(64 * (j + m)), so each window is below power * 2^(64 * m).
+        for (size_t j = n > 2 * m ? n - 2 * m : 0;; j = j > m ? j - m : 0) {
+            const size_t size = remainder.limbs.size();
+            if (size > j) {
+                bigint window = from_limbs(remainder.limbs.data() + j, size - j);
+                bigint estimate;
+                if (size - j >= m) {
+                    const bigint top = from_limbs(window.limbs.data() + m - 1, size - j - m + 1);
+                    const bigint scaled = top * inverse;
+                    if (scaled.limbs.size() > m + 1) {
+                        estimate = from_limbs(scaled.limbs.data() + m + 1, scaled.limbs.size() - m - 1);
+                    }
+                }
+                window -= estimate * power;
+                while (window >= power) {
+                    window -= power;
+                    ++estimate;
+                }
+                std::copy_n(estimate.limbs.data(), estimate.limbs.size(), quotient.limbs.data() + j);
+                remainder.limbs.resize(j + window.limbs.size());
+                std::copy_n(window.limbs.data(), window.limbs.size(), remainder.limbs.data() + j);
+                remainder.remove_leading_zeros();
+            }
+            if (j == 0) break;
+        }
+        quotient.remove_leading_zeros();
+    }
+
+    /**
+     * @brief Smallest size, in limbs, for which decimal conversion splits the number.
+     */
+    static size_t str_threshold() {
+        return std::max<size_t>(bigint_detail::tuning.str_divide_conquer, 2);
+    }
+
+    /**
+     * @brief Replaces the magnitude with the value of a run of decimal digits.
+     *
+     *        Below the threshold the digits are folded in 19 at a time. Above it the
+     *        low 19 * 2^k digits, about half of them, are parsed separately and the
+     *        result is assembled as high * 10^(19 * 2^k) + low.
+     *        Constant evaluation always folds, as the power table is built at run time.
+     *
+     * @param digits The digits, most significant first, already checked to be '0' to '9'.
+     * @param count The number of digits.
+     */
+    constexpr void assign_decimal(const char* digits, size_t count) {
+        const size_t chunk_digits = bigint_detail::decimal_chunk_digits;
+        const size_t chunks = (count + chunk_digits - 1) / chunk_digits;
+        if (std::is_constant_evaluated() || chunks < str_threshold()) {
+            bigint_detail::count_algorithm(bigint_detail::algorithm_kind::str_basecase);
+            limbs.clear();
+            limbs.reserve(chunks);
+            size_t chunk = count % chunk_digits;
+            if (chunk == 0) chunk = chunk_digits;
+            for (size_t pos = 0; pos < count; pos += chunk, chunk = chunk_digits) {
+                limb_t value = 0;
+                limb_t scale = 1;
+                for (size_t i = pos; i < pos + chunk; ++i) {
+                    value = value * 10 + static_cast<limb_t>(digits[i] - '0');
+                    scale *= 10;
+                }
+                multiply_add_limb(scale, value);
+            }
+            remove_leading_zeros();
+            return;
+        }
+        bigint_detail::count_algorithm(bigint_detail::algorithm_kind::str_divide_conquer);
+        const unsigned k = static_cast<unsigned>(std::bit_width(chunks / 2) - 1);
+        const size_t low_digits = chunk_digits << k;
+        bigint high, low;
+        high.assign_decimal(digits, count - low_digits);
+        low.assign_decimal(digits + count - low_digits, low_digits);
+        *this = high * decimal_power(k) + low;
+    }
+
+    /**
+     * @brief Writes the decimal digits of the magnitude, ignoring the sign.
+     *
+     *        Below the threshold the magnitude is cut into base-10^19 chunks by repeated
+     *        single-limb division. Above it the magnitude is divided by the largest table
+     *        power 10^(19 * 2^k) of at most half its size, using its cached reciprocal,
+     *        and quotient and remainder are written recursively, the remainder padded
+     *        to exactly 19 * 2^k digits.
+     *
+     * @param out Destination with room for all digits of the magnitude, and width if larger.
+     * @param width Minimum number of digits, reached by leading zeros; 0 for none.
+     * @return A pointer past the last digit written.
+     */
+    char* write_decimal(char* out, size_t width) const {
+        const size_t chunk_digits = bigint_detail::decimal_chunk_digits;
+        const size_t n = limbs.size();
+        if (n < str_threshold()) {
+            bigint_detail::count_algorithm(bigint_detail::algorithm_kind::str_basecase);
+            // Each limb holds less than 1.02 chunks, so n + n / 32 + 2 chunks suffice.
+            // Numbers of up to local_limbs limbs are converted without allocating.
+            constexpr size_t local_limbs = 32;
+            limb_t local[2 * local_limbs + local_limbs / 32 + 2];
+            bigint_detail::scratch_vector<limb_t> heap;
+            limb_t* rest = local;
+            if (n > local_limbs) {
+                heap.resize(2 * n + n / 32 + 2);
+                rest = heap.data();
+            }
+            limb_t* chunks = rest + n;
+            size_t rest_size = n;
+            size_t chunk_count = 0;
+            std::copy_n(limbs.data(), n, rest);
+            while (rest_size > 0) {
+                chunks[chunk_count++] = bigint_detail::divrem_1(rest, rest, rest_size, bigint_detail::decimal_chunk);
+                while (rest_size > 0 && rest[rest_size - 1] == 0) --rest_size;
+            }
+            char top[chunk_digits + 1];
+            const size_t top_digits = chunk_count == 0 ? 0
+                : static_cast<size_t>(std::to_chars(top, top + sizeof(top), chunks[chunk_count - 1]).ptr - top);
+            const size_t total = chunk_count == 0 ? 0 : top_digits + (chunk_count - 1) * chunk_digits;
+            if (width > total) out = std::fill_n(out, width - total, '0');
+            if (chunk_count == 0) return out;
+            out = std::copy_n(top, top_digits, out);
+            for (size_t i = chunk_count - 1; i-- > 0;) {
+                limb_t chunk = chunks[i];
+                for (size_t j = chunk_digits; j-- > 0;) {
+                    out[j] = static_cast<char>('0' + chunk % 10);
+                    chunk /= 10;
+                }
+                out += chunk_digits;
+            }
+            return out;
+        }
+        bigint_detail::count_algorithm(bigint_detail::algorithm_kind::str_divide_conquer);
+        const unsigned k = static_cast<unsigned>(std::bit_width(n / 2) - 1);
+        const size_t low_digits = chunk_digits << k;
+        bigint high, low;
+        divide_by_power(*this, k, high, low);
+        out = high.write_decimal(out, width > low_digits ? width - low_digits : 0);
+        return low.write_decimal(out, low_digits);
+    }
+
+    /**
+     * @brief Writes the sign, if negative, and the decimal digits of the value.
+     *
+     * @param out Destination with room for at least decimal_size() characters.
+     * @return A pointer past the last character written.
+     */
+    char* write_text(char* out) const {
+        if (limbs.empty()) {
+            *out = '0';
+            return out + 1;
+        }
+        const bigint_detail::operation_timer timer(bigint_detail::operation_kind::print, limbs.size());
+        if (is_negative) *out++ = '-';
+        return write_decimal(out, 0);
+    }
+
+    /**
+     * @brief Writes the decimal digits of the magnitude to a stream through buffer,
+     *        splitting the number as write_decimal does until each part fits.
+     *
+     * @param width Minimum number of digits, reached by leading zeros; 0 for none.
+     * @param buffer At least stream_buffer_bytes characters.
+     */
+    void write_blocks(std::ostream& os, size_t width, std::span<char> buffer) const {
+        if (decimal_size() > buffer.size()) {
+            bigint_detail::count_algorithm(bigint_detail::algorithm_kind::str_divide_conquer);
+            const unsigned k = static_cast<unsigned>(std::bit_width(limbs.size() / 2) - 1);
+            const size_t low_digits = bigint_detail::decimal_chunk_digits << k;
+            bigint high, low;
+            divide_by_power(*this, k, high, low);
+            high.write_blocks(os, width > low_digits ? width - low_digits : 0, buffer);
+            low.write_blocks(os, low_digits, buffer);
+            return;
+        }
+        // The digits fit the buffer, so any zeros beyond its size lead them.
+        if (width > buffer.size()) std::fill(buffer.begin(), buffer.end(), '0');
+        for (; width > buffer.size(); width -= buffer.size()) {
+            os.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+        }
+        os.write(buffer.data(), write_decimal(buffer.data(), width) - buffer.data());
+    }
+
+    /**
+     * @brief Writes the sign and decimal digits of the value to a stream, through a
+     *        buffer of stream_buffer_bytes characters whatever the size of the number.
+     */
+    void write_stream(std::ostream& os) const {
+        if (limbs.empty()) {
+            os.put('0');
+            return;
+        }
+        const bigint_detail::operation_timer timer(bigint_detail::operation_kind::print, limbs.size());
+        std::vector<char> buffer(bigint_detail::stream_buffer_bytes);
+        if (is_negative) os.put('-');
+        write_blocks(os, 0, buffer);
+    }
+
+    /**
+     * @brief Blocks of a decimal number read so far, each with its level: a block of
+     *        level j holds 19 * 2^(stream_block_level + j) digits. Levels strictly
+     *        decrease from the most significant block.
+     *
+     *        The powers that merge the blocks are kept here rather than in the table of
+     *        decimal_power, so that their memory is returned as soon as they are used
+     *        for the last time instead of staying cached for the life of the program.
+     */
+    struct decimal_blocks {
+        std::vector<std::pair<bigint, size_t>> parts;
+        std::vector<bigint> powers;
+
+        /**
+         * @brief Returns 10^(19 * 2^(stream_block_level + level)).
+         */
+        const bigint& power(size_t level) {
+            if (powers.empty()) powers.push_back(decimal_power(bigint_detail::stream_block_level));
+            while (powers.size() <= level) powers.push_back(powers.back() * powers.back());
+            return powers[level];
+        }
+    };
+
+    /**
+     * @brief Appends a block of stream_block_digits digits, merging equal levels like a
+     *        binary counter so that every product combines operands of equal size.
+     */
+    static void push_decimal_block(decimal_blocks& blocks, const char* digits) {
+        bigint block;
+        (void)from_chars(digits, digits + bigint_detail::stream_block_digits, block);
+        size_t level = 0;
+        while (!blocks.parts.empty() && blocks.parts.back().second == level) {
+            bigint merged = blocks.parts.back().first * blocks.power(level) + block;
+            block = std::move(merged);
+            blocks.parts.pop_back();
+            ++level;
+        }
+        blocks.parts.emplace_back(std::move(block), level);
+    }
+
+    /**
+     * @brief Assembles the blocks, most significant first, and the final count < stream_block_digits digits.
+     *        Each block and each power is freed once merged, as later blocks are shorter.
+     */
+    static bigint finish_decimal_blocks(decimal_blocks& blocks, const char* digits, size_t count) {
+        bigint result;
+        for (auto& [block, level] : blocks.parts) {
+            if (result.limbs.empty()) {
+                result = std::move(block);
+            } else {
+                bigint merged = result * blocks.power(level) + block;
+                result = std::move(merged);
+                block = bigint();
+            }
+            blocks.powers.resize(std::min(blocks.powers.size(), level));
+        }
+        if (count > 0) {
+            bigint tail;
+            (void)from_chars(digits, digits + count, tail);
+            if (blocks.parts.empty()) return tail;
+            bigint merged = result * pow(bigint(10), count) + tail;
+            result = std::move(merged);
+        }
+        return result;
+    }
+
+    /**
+     * @brief Number of bytes in the magnitude, without leading zero bytes.
+     */
+    size_t magnitude_bytes() const {
+        if (limbs.empty()) return 0;
+        return (limbs.size() - 1) * sizeof(limb_t) + static_cast<size_t>(std::bit_width(limbs.back()) + 7) / 8;
+    }
+
+    /**
+     * @brief Returns byte k of the magnitude, counting from the least significant.
+     */
+    std::byte byte_at(size_t k) const {
+        return static_cast<std::byte>(limbs[k / sizeof(limb_t)] >> (k % sizeof(limb_t) * 8));
+    }
+
+    /**
+     * @brief Sets byte k of the magnitude, counting from the least significant, which must be zero.
+     */
+    void set_byte(size_t k, std::byte value) {
+        limbs[k / sizeof(limb_t)] |= static_cast<limb_t>(value) << (k % sizeof(limb_t) * 8);
+    }
+
+    /**
+     * @brief Number of exponent bits combined into one multiplication by sliding-window
+     *        exponentiation, growing with the exponent so that the table of odd powers
+     *        stays small next to the number of squarings.
+     */
+    static unsigned window_bits(size_t exponent_bits) {
+        if (exponent_bits > 671) return 6;
+        if (exponent_bits > 239) return 5;
+        if (exponent_bits > 79) return 4;
+        if (exponent_bits > 23) return 3;
+        return exponent_bits > 7 ? 2 : 1;
+    }
+
+    /**
+     * @brief Raises x to a positive power by left-to-right sliding-window exponentiation.
+     *
+     *        Runs of zero bits cost one squaring each; every other window of up to
+     *        window_bits() bits ending in a one costs its squarings plus a single
+     *        multiplication by a precomputed odd power.
+     *
+     * @param x Holds the base on entry and the power on return.
+     * @param exp The exponent, greater than zero.
+     * @param square Callable squaring its argument in place.
+     * @param multiply Callable multiplying its first argument in place by its second.
+     */
+    template <typename T, typename Square, typename Multiply>
+    static void sliding_window_pow(T& x, const bigint& exp, Square square, Multiply multiply) {
+        const size_t bits = (exp.limbs.size() - 1) * bigint_detail::limb_bits
+                          + static_cast<size_t>(std::bit_width(exp.limbs.back()));
+        const unsigned k = window_bits(bits);
+        const auto bit = [&exp](size_t i) {
+            return static_cast<unsigned>(exp.limbs[i / bigint_detail::limb_bits] >> (i % bigint_detail::limb_bits)) & 1;
+        };
+
+        // odd[i] = x^(2 * i + 1)
+        bigint_detail::scratch_vector<T> odd(size_t{1} << (k - 1), x);
+        if (odd.size() > 1) {
+            T x2 = x;
+            square(x2);
+            for (size_t i = 1; i < odd.size(); ++i) {
+                odd[i] = odd[i - 1];
+                multiply(odd[i], x2);
+            }
+        }
+
+        bool started = false;
+        for (size_t i = bits; i > 0;) {
+            if (!bit(i - 1)) {
+                square(x);
+                --i;
+                continue;
+            }
+            size_t low = i > k ? i - k : 0;
+            while (!bit(low)) ++low;
+            size_t window = 0;
+            for (size_t j = i; j-- > low;) window = window << 1 | bit(j);
+            if (started) {
+                for (size_t j = low; j < i; ++j) square(x);
+                multiply(x, odd[window >> 1]);
+            } else {
+                x = odd[window >> 1];
+                started = true;
+            }
+            i = low;
+        }
+    }
+
+    /**
+     * @brief Modular exponentiation in Montgomery form, for an odd modulus.
+     *
+     *        Residues are kept as n-limb arrays scaled by 2^(64 * n), so that each
+     *        product is reduced by redc_1 with no division at all. Squarings go through
+     *        the squaring path of mul_limbs.
+     *
+     * @param base The base, already reduced into [0, mod).
+     * @param mod The modulus, odd and positive.
+     */
+    static bigint powmod_montgomery(const bigint& base, const bigint& exp, const bigint& mod) {
+        const size_t n = mod.limbs.size();
+        const limb_t* m = mod.limbs.data();
+        const limb_t minv = limb_t{0} - bigint_detail::inverse_limb(m[0]);
+
+        bigint scaled;
+        scaled.limbs.resize(n + base.limbs.size());
+        std::copy_n(base.limbs.data(), base.limbs.size(), scaled.limbs.data() + n);
+        scaled %= mod;
+        bigint_detail::scratch_vector<limb_t> x(n);
+        std::copy_n(scaled.limbs.data(), scaled.limbs.size(), x.data());
+
+        bigint_detail::scratch_vector<limb_t> t(2 * n);
+        const auto square = [&](bigint_detail::scratch_vector<limb_t>& value) {
+            mul_limbs(t.data(), value.data(), n, value.data(), n);
+            bigint_detail::redc_1(value.data(), t.data(), m, n, minv);
+        };
+        const auto multiply = [&](bigint_detail::scratch_vector<limb_t>& value, const bigint_detail::scratch_vector<limb_t>& factor) {
+            mul_limbs(t.data(), value.data(), n, factor.data(), n);
+            bigint_detail::redc_1(value.data(), t.data(), m, n, minv);
+        };
+        sliding_window_pow(x, exp, square, multiply);
+
+        std::copy_n(x.data(), n, t.data());
+        std::fill_n(t.data() + n, n, limb_t{0});
+        bigint_detail::redc_1(x.data(), t.data(), m, n, minv);
+        return from_limbs(x.data(), n);
+    }
+
+    /**
+     * @brief Multiplies a list of bigints by a balanced product tree, consuming the list.
+     *
+     *        Neighbours are multiplied pairwise, level by level, so the two factors of
+     *        every product are of similar size and the large products near the root
+     *        reach the subquadratic algorithms. A left fold would instead multiply an
+     *        ever longer partial product by one short factor at a time.
+     *
+     * @return The product, 1 for an empty list.
+     */
+    static bigint product_tree(bigint_vector& values) {
+        if (values.empty()) return bigint(1);
+        while (values.size() > 1) {
+            const size_t half = values.size() / 2;
+            for (size_t i = 0; i < half; ++i) {
+                values[i] = values[2 * i] * values[2 * i + 1];
+            }
+            if (values.size() % 2 != 0) values[half] = std::move(values.back());
+            values.resize(values.size() - half);
+        }
+        return std::move(values[0]);
+    }
+
+    /**
+     * @brief Multiplies a list of limbs by a product tree, after packing runs of
+     *        neighbouring factors whose product fits into a single limb.
+     *
+     * @return The product, 1 for an empty list.
+     */
+    static bigint product_of_limbs(const bigint_detail::scratch_vector<limb_t>& factors) {
+        bigint_vector values;
+        limb_t packed = 1;
+        for (const limb_t factor : factors) {
+            const bigint_detail::dlimb_t p = static_cast<bigint_detail::dlimb_t>(packed) * factor;
+            if ((p >> bigint_detail::limb_bits) != 0) {
+                values.emplace_back(packed);
+                packed = factor;
+            } else {
+                packed = static_cast<limb_t>(p);
+            }
+        }
+        values.emplace_back(packed);
+        return product_tree(values);
+    }
+
+    /**
+     * @brief Computes the odd part of n!, recursively as the square of the odd part of
+     *        (n / 2)! times the odd part of the swing n! / ((n / 2)!)^2.
+     *
+     * @param primes The odd primes up to at least n.
+     */
+    static bigint odd_factorial(uint64_t n, const bigint_detail::scratch_vector<limb_t>& primes) {
+        // Up to 20! the factorial fits into a limb.
+        if (n <= 20) {
+            limb_t f = 1;
+            for (limb_t i = 2; i <= n; ++i) f *= i;
+            return bigint(f >> std::countr_zero(f));
+        }
+        const bigint half = odd_factorial(n / 2, primes);
+        return square(half) * odd_swing(n, primes);
+    }
+
+    /**
+     * @brief Computes the odd part of the swing n! / ((n / 2)!)^2 from its prime factors:
+     *        an odd prime p occurs to the power of the number of odd quotients n / p^i.
+     *        Every p^e is at most n, so each fits into a limb.
+     */
+    static bigint odd_swing(uint64_t n, const bigint_detail::scratch_vector<limb_t>& primes) {
+        bigint_detail::scratch_vector<limb_t> factors;
+        for (const limb_t p : primes) {
+            if (p > n) break;
+            limb_t power = 1;
+            for (uint64_t q = n / p; q > 0; q /= p) {
+                if ((q & 1) != 0) power *= p;
+            }
+            if (power != 1) factors.push_back(power);
+        }
+        return product_of_limbs(factors);
+    }
+
 public:
-    bigint() : is_negative(false) {digits.push_back(0);}
+    /**
+     * @brief Gives access to the algorithm crossover thresholds used by multiplication.
+     *
+     *        The returned parameters are shared by all bigint objects and may be changed
+     *        at runtime to adapt the crossover points to the current machine. They should
+     *        not be modified while other threads are computing with bigint.
+     *
+     * @return A reference to the process-wide tuning parameters.
+     */
+    static bigint_detail::tuning_parameters& tuning() {
+        return bigint_detail::tuning;
+    }
 
     /**
-     * @brief Constructs a bigint object from a given int64_t number.
-     *        The number is converted into its digit representation,
-     *        with each digit stored in the `digits` vector in reverse order.
-     *        Handles both positive and negative numbers.
+     * @brief Enables or disables the parallel multiplication mode.
      *
-     * @param num The int64_t number to initialize the bigint object.
-     *            If the number is negative, the bigint will be marked
-     *            as negative.
-     * @return A bigint object representing the given number.
+     *        With more than one thread, large multiplications schedule their Karatsuba
+     *        and Toom-Cook sub-products and their NTT transforms and butterfly stages on
+     *        a shared work-stealing pool of threads - 1 workers, the calling thread being
+     *        the remaining one. Results are identical to the serial path. Must not be
+     *        called while other threads are computing with bigint.
+     *
+     * @param threads The total number of threads to use; 0 or 1 restores serial operation.
+     * @param grain The smallest operand size, in limbs, or transform stage size, in
+     *              butterflies, that is split into parallel tasks.
      */
-    explicit bigint(int64_t num) : is_negative(num < 0) {
-        if (num < 0) num = - num;
-        do {
-            digits.push_back(num % 10);
-            num = num / 10;
-        } while (num > 0);
+    static void set_parallelism(size_t threads, size_t grain = BIGINT_PARALLEL_GRAIN) {
+        bigint_detail::pool.reset();
+        bigint_detail::parallel = {threads > 1 ? threads : 0, std::max<size_t>(grain, 1)};
+        if (threads > 1) bigint_detail::pool = std::make_unique<bigint_detail::thread_pool>(threads - 1);
     }
 
     /**
-     * @brief Constructs a bigint object from a string representation of a number.
-     *        Initializes the bigint object based on the input string, which may
-     *        include an optional leading "-" to indicate a negative number.
+     * @brief Reports the current parallel multiplication settings.
      *
-     * @param str The string representation of the number to initialize the bigint object with.
-     *            Must contain only digits and an optional leading "-" for negative numbers.
-     *            Leading zeros are handled appropriately, and the result will not maintain
-     *            them in storage.
+     * @return The thread count (0 when serial) and grain size in effect.
+     */
+    static bigint_detail::parallel_parameters parallelism() {
+        return bigint_detail::parallel;
+    }
+
+    /**
+     * @brief Returns the operation, algorithm and allocation counters of the calling thread.
      *
-     * @throw std::invalid_argument Throws an exception if the input string is empty
-     *                               or contains invalid (non-digit) characters.
+     *        Counting is compiled in only when BIGINT_ENABLE_STATS is defined before
+     *        including this header; otherwise every counter stays zero and the hooks
+     *        cost nothing. The counters are per thread and need no synchronization, so
+     *        in parallel mode the sub-products run by pool workers count into the
+     *        workers' own counters, not those of the thread that started the product.
+     *
+     * @return A snapshot of the counters since the thread started or last called reset_stats().
      */
-    explicit bigint(const std::string& str) : is_negative(false) {
-        if (str.empty()) throw std::invalid_argument("bigint string is empty");
+    static bigint_detail::statistics stats() {
+#ifdef BIGINT_ENABLE_STATS
+        return bigint_detail::thread_statistics;
+#else
+        return {};
+#endif
+    }
 
-        size_t lead = 0;
-        if (str[0] == '-') {
-            is_negative = true;
-            lead = 1;
+    /**
+     * @brief Sets all counters of the calling thread to zero.
+     */
+    static void reset_stats() {
+#ifdef BIGINT_ENABLE_STATS
+        bigint_detail::thread_statistics = {};
+#endif
+    }
+
+    /**
+     * @brief Equality operator for comparing two bigint objects.
+     *        Checks if both the is_negative flag and the limbs of the
+     *        two bigint objects are identical. Being a hidden friend, it also
+     *        accepts unevaluated expressions on either side.
+     *
+     * @param lhs The left-hand bigint object.
+     * @param rhs The right-hand bigint object.
+     * @return true if both bigint objects are equal, otherwise false.
+     */
+    friend constexpr bool operator==(const bigint& lhs, const bigint& rhs) {
+        return lhs.is_negative == rhs.is_negative && lhs.limbs == rhs.limbs;
+    }
+
+    /**
+     * @brief Inequality operator for comparing two bigint objects.
+     *        Determines if the two bigint objects are not equal.
+     *
+     * @param lhs The left-hand bigint object.
+     * @param rhs The right-hand bigint object.
+     * @return True if the two bigint objects are not equal, otherwise false.
+     */
+    friend constexpr bool operator!=(const bigint& lhs, const bigint& rhs) {
+        return !(lhs == rhs);
+    }
+
+    /**
+     * @brief Overloads the `<` operator to compare two bigint objects.
+     *        Determines whether the left bigint object is less than
+     *        the right bigint object.
+     *
+     * @param lhs The left-hand bigint object.
+     * @param rhs The bigint object to compare against.
+     * @return True if the left bigint object is less than the right
+     *         bigint object, otherwise False.
+     */
+    friend constexpr bool operator<(const bigint& lhs, const bigint& rhs) {
+        if (lhs.is_negative != rhs.is_negative) return lhs.is_negative;
+        const int order = bigint_detail::cmp(lhs.limbs.data(), lhs.limbs.size(), rhs.limbs.data(), rhs.limbs.size());
+        return lhs.is_negative ? order > 0 : order < 0;
+    }
+
+    /**
+     * @brief Overloaded greater-than operator for comparing two bigint objects.
+     *
+     *        Compares a bigint object with another bigint object to determine
+     *        if the left object is greater.
+     *
+     * @param lhs The left-hand bigint object.
+     * @param rhs A reference to the bigint object being compared to the left one.
+     *
+     * @return True if the left bigint object is greater than the right bigint object,
+     *         otherwise false.
+     */
+    friend constexpr bool operator>(const bigint& lhs, const bigint& rhs) {
+        return rhs < lhs;
+    }
+
+    /**
+     * @brief Compares two bigint objects to determine if the left one is
+     *        greater than or equal to the other.
+     *
+     * @param lhs The left-hand bigint object.
+     * @param rhs The bigint object to compare against.
+     * @return True if the left object is greater than or equal to the right bigint object,
+     *         otherwise false.
+     */
+    friend constexpr bool operator>=(const bigint& lhs, const bigint& rhs) {
+        return !(lhs < rhs);
+    }
+
+    /**
+     * @brief Overloaded less than or equal to operator for bigint comparison.
+     *        Compares two bigint objects to determine if the left one is
+     *        less than or equal to the right one.
+     *
+     * @param lhs The left-hand bigint object.
+     * @param rhs A constant reference to the bigint object to compare with.
+     * @return True if the left bigint object is less than or equal
+     *         to the right bigint, otherwise false.
+     */
+    friend constexpr bool operator<=(const bigint& lhs, const bigint& rhs) {
+        return rhs >= lhs;
+    }
+
+    /**
+     * @brief Three-way comparison of two bigint objects.
+     *
+     * @param lhs The left-hand bigint object.
+     * @param rhs The right-hand bigint object.
+     * @return The ordering of lhs relative to rhs.
+     */
+    friend constexpr std::strong_ordering operator<=>(const bigint& lhs, const bigint& rhs) {
+        if (lhs.is_negative != rhs.is_negative) {
+            return lhs.is_negative ? std::strong_ordering::less : std::strong_ordering::greater;
+        }
+        const int order = bigint_detail::cmp(lhs.limbs.data(), lhs.limbs.size(), rhs.limbs.data(), rhs.limbs.size());
+        return lhs.is_negative ? 0 <=> order : order <=> 0;
+    }
+
+    /**
+     * @brief Compares a bigint with a built-in integer without converting either,
+     *        looking at no more than the sign, the limb count and one limb. The
+     *        reversed forms and the relational operators are synthesized from these.
+     *
+     * @param lhs The bigint object.
+     * @param rhs The built-in integer.
+     * @return Whether the values are equal, or their ordering.
+     */
+    template <bigint_detail::native_integer T>
+    friend constexpr bool operator==(const bigint& lhs, T rhs) {
+        return lhs.compare_limb(native_magnitude(rhs), std::cmp_less(rhs, 0)) == 0;
+    }
+
+    template <bigint_detail::native_integer T>
+    friend constexpr std::strong_ordering operator<=>(const bigint& lhs, T rhs) {
+        return lhs.compare_limb(native_magnitude(rhs), std::cmp_less(rhs, 0));
+    }
+
+    /**
+     * @brief Returns an upper bound on the number of characters to_chars and operator<<
+     *        produce for this value, sign included. The bound is computed from the bit
+     *        length alone and exceeds the exact length by at most one below 2^(10^9).
+     *
+     * @return The number of characters a buffer must hold to print the value.
+     */
+    size_t decimal_size() const {
+        if (limbs.empty()) return 1;
+        const size_t bits = (limbs.size() - 1) * bigint_detail::limb_bits
+                          + static_cast<size_t>(std::bit_width(limbs.back()));
+        // 1292913987 / 2^32 exceeds log10(2) by less than 10^-10, so the digit count is
+        // never underestimated.
+        const auto digits = static_cast<size_t>((static_cast<bigint_detail::dlimb_t>(bits) * 1292913987) >> 32);
+        return digits + 1 + (is_negative ? 1 : 0);
+    }
+
+    /**
+     * @brief Parses a decimal number at the start of a character range, in the manner of
+     *        std::from_chars: an optional "-" followed by as many digits as are present.
+     *
+     *        Reports errors instead of throwing and reuses the storage of value, so
+     *        numbers that fit the existing capacity are parsed without allocating.
+     *
+     * @param first The start of the range.
+     * @param last The end of the range.
+     * @param value Receives the parsed number; left unchanged on error.
+     * @return {pointer past the last digit, std::errc{}} on success, or {first,
+     *         std::errc::invalid_argument} if the range does not start with a number.
+     */
+    friend constexpr std::from_chars_result from_chars(const char* first, const char* last, bigint& value) {
+        const char* digits = first != last && *first == '-' ? first + 1 : first;
+        const char* end = digits;
+        while (end != last && *end >= '0' && *end <= '9') ++end;
+        if (end == digits) return {first, std::errc::invalid_argument};
+        const auto count = static_cast<size_t>(end - digits);
+        const bigint_detail::operation_timer timer(bigint_detail::operation_kind::parse,
+                                                   count / bigint_detail::decimal_chunk_digits + 1);
+        value.assign_decimal(digits, count);
+        value.is_negative = digits != first && !value.limbs.empty();
+        return {end, std::errc{}};
+    }
+
+    /**
+     * @brief Writes the decimal representation of a bigint into a character range, in the
+     *        manner of std::to_chars. No terminating null character is written.
+     *
+     *        Numbers below the divide-and-conquer threshold are converted without
+     *        allocating whenever the range holds decimal_size() characters.
+     *
+     * @param first The start of the range.
+     * @param last The end of the range.
+     * @param value The number to write.
+     * @return {pointer past the last character, std::errc{}} on success, or {last,
+     *         std::errc::value_too_large} if the range is too short, leaving its contents
+     *         unspecified.
+     */
+    friend std::to_chars_result to_chars(char* first, char* last, const bigint& value) {
+        const size_t room = static_cast<size_t>(last - first);
+        const size_t bound = value.decimal_size();
+        if (room >= bound) return {value.write_text(first), std::errc{}};
+
+        // The bound may overshoot by one, so convert aside to learn the exact length.
+        char local[256];
+        std::string heap;
+        char* text = local;
+        if (bound > sizeof(local)) {
+            heap.resize(bound);
+            text = heap.data();
+        }
+        const size_t length = static_cast<size_t>(value.write_text(text) - text);
+        if (length > room) return {last, std::errc::value_too_large};
+        return {std::copy_n(text, length, first), std::errc{}};
+    }
+
+    /**
+     * @brief Returns the number of bytes export_bytes writes for this value: the bytes of
+     *        the magnitude, rounded up to whole words, and 0 for zero.
+     *
+     * @throw std::invalid_argument Throws an exception if word_size is zero.
+     */
+    size_t export_size(size_t word_size = 1) const {
+        if (word_size == 0) throw std::invalid_argument("bigint export with zero word size");
+        return (magnitude_bytes() + word_size - 1) / word_size * word_size;
+    }
+
+    /**
+     * @brief Writes the magnitude in binary, in the manner of mpz_export. The sign is
+     *        not written; callers that need it store value < 0 alongside.
+     *
+     *        The magnitude is cut into words of word_size bytes, the top word padded with
+     *        zero bytes. On a little-endian host, little order with native endianness,
+     *        or little order with one-byte words, is the layout of the limbs, which are
+     *        then copied with a single memcpy; big-endian order is written a limb at a
+     *        time with byte swaps.
+     *
+     * @param out Destination of at least export_size(word_size) bytes.
+     * @param order std::endian::little to write the least significant word first,
+     *              std::endian::big for the most significant first.
+     * @param word_size Number of bytes per word.
+     * @param endian Order of the bytes within each word.
+     * @return The number of bytes written, export_size(word_size).
+     * @throw std::invalid_argument Throws an exception if word_size is zero or out is too short.
+     */
+    size_t export_bytes(std::span<std::byte> out, std::endian order = std::endian::little, size_t word_size = 1,
+                        std::endian endian = std::endian::native) const {
+        const size_t size = export_size(word_size);
+        if (out.size() < size) throw std::invalid_argument("bigint export buffer too short");
+        const size_t bytes = magnitude_bytes();
+        std::byte* dst = out.data();
+        if (word_size == 1) endian = order;
+        if (order == endian && std::endian::native == std::endian::little) {
+            if (order == std::endian::little) {
+                std::memcpy(dst, limbs.data(), bytes);
+                std::fill(dst + bytes, dst + size, std::byte{0});
+                return size;
+            }
+            const size_t full = bytes / sizeof(limb_t);
+            std::fill(dst, dst + size - bytes, std::byte{0});
+            for (size_t i = 0; i < full; ++i) {
+                const limb_t limb = std::byteswap(limbs[i]);
+                std::memcpy(dst + size - (i + 1) * sizeof(limb_t), &limb, sizeof(limb_t));
+            }
+            for (size_t k = full * sizeof(limb_t); k < bytes; ++k) dst[size - 1 - k] = byte_at(k);
+            return size;
+        }
+        const size_t words = size / word_size;
+        size_t k = 0;
+        for (size_t w = 0; w < words; ++w) {
+            std::byte* word = dst + (order == std::endian::little ? w : words - 1 - w) * word_size;
+            for (size_t b = 0; b < word_size; ++b, ++k) {
+                word[endian == std::endian::little ? b : word_size - 1 - b] = k < bytes ? byte_at(k) : std::byte{0};
+            }
+        }
+        return size;
+    }
+
+    /**
+     * @brief Replaces the value with a magnitude read in binary, in the manner of
+     *        mpz_import, and an explicit sign. The layout parameters are those of
+     *        export_bytes, and the same layouts are read with a memcpy or byte swaps.
+     *        Reuses the storage of the value, so numbers that fit the existing capacity
+     *        are read without allocating.
+     *
+     * @param in The words, their count being in.size() / word_size.
+     * @param negative Whether the value is negative; ignored when the magnitude is zero.
+     * @return A reference to this object.
+     * @throw std::invalid_argument Throws an exception if word_size is zero or does not
+     *                              divide the size of in.
+     */
+    bigint& import_bytes(std::span<const std::byte> in, bool negative, std::endian order = std::endian::little,
+                         size_t word_size = 1, std::endian endian = std::endian::native) {
+        if (word_size == 0 || in.size() % word_size != 0) {
+            throw std::invalid_argument("bigint import size is not a multiple of the word size");
+        }
+        const size_t size = in.size();
+        const std::byte* src = in.data();
+        limbs.clear();
+        limbs.resize((size + sizeof(limb_t) - 1) / sizeof(limb_t));
+        if (word_size == 1) endian = order;
+        if (order == endian && std::endian::native == std::endian::little) {
+            if (order == std::endian::little) {
+                std::memcpy(limbs.data(), src, size);
+            } else {
+                const size_t full = size / sizeof(limb_t);
+                for (size_t i = 0; i < full; ++i) {
+                    limb_t limb;
+                    std::memcpy(&limb, src + size - (i + 1) * sizeof(limb_t), sizeof(limb_t));
+                    limbs[i] = std::byteswap(limb);
+                }
+                for (size_t k = full * sizeof(limb_t); k < size; ++k) set_byte(k, src[size - 1 - k]);
+            }
+        } else {
+            const size_t words = size / word_size;
+            size_t k = 0;
+            for (size_t w = 0; w < words; ++w) {
+                const std::byte* word = src + (order == std::endian::little ? w : words - 1 - w) * word_size;
+                for (size_t b = 0; b < word_size; ++b, ++k) {
+                    set_byte(k, word[endian == std::endian::little ? b : word_size - 1 - b]);
+                }
+            }
+        }
+        remove_leading_zeros();
+        is_negative = negative && !limbs.empty();
+        return *this;
+    }
+
+    /**
+     * @brief Inserts the decimal representation of a bigint into an output stream.
+     *
+     *        The digits are produced by a divide-and-conquer conversion whose cost
+     *        stays close to that of multiplication, and written in a single call,
+     *        from a stack buffer when the number is short enough.
+     *
+     * @param os The output stream to write to.
+     * @param num The bigint to print.
+     * @return The output stream, to allow chaining.
+     */
+    friend std::ostream& operator<<(std::ostream& os, const bigint& num) {
+        if (num.decimal_size() > bigint_detail::stream_buffer_bytes) {
+            num.write_stream(os);
+            return os;
+        }
+        char local[256];
+        std::string heap;
+        char* text = local;
+        if (num.decimal_size() > sizeof(local)) {
+            heap.resize(num.decimal_size());
+            text = heap.data();
+        }
+        const char* end = num.write_text(text);
+        return os.write(text, end - text);
+    }
+
+    /**
+     * @brief Extracts a decimal number from an input stream: after leading whitespace
+     *        unless std::skipws is off, an optional "-" followed by as many digits as
+     *        the stream holds.
+     *
+     *        The digits are converted in blocks of 19 * 2^12 as they arrive, and the
+     *        blocks are combined pairwise by powers of ten that are freed afterwards,
+     *        so the text is never held in full and the conversion keeps the quasi-linear
+     *        cost of parsing a string.
+     *
+     * @param is The input stream to read from.
+     * @param value Receives the number; left unchanged, with failbit set, if the stream
+     *              does not start with one.
+     * @return The input stream, to allow chaining.
+     */
+    friend std::istream& operator>>(std::istream& is, bigint& value) {
+        const std::istream::sentry sentry(is);
+        if (!sentry) return is;
+        using traits = std::istream::traits_type;
+        std::streambuf& buffer = *is.rdbuf();
+        const bool negative = buffer.sgetc() == '-';
+        if (negative) buffer.sbumpc();
+        decimal_blocks blocks;
+        std::string digits;
+        digits.reserve(bigint_detail::stream_block_digits);
+        traits::int_type c = buffer.sgetc();
+        for (; c >= '0' && c <= '9'; c = buffer.snextc()) {
+            digits.push_back(traits::to_char_type(c));
+            if (digits.size() == bigint_detail::stream_block_digits) {
+                push_decimal_block(blocks, digits.data());
+                digits.clear();
+            }
         }
-        for (size_t i = lead; i < str.size(); ++i) {
-            if (!isdigit(str[i])) throw std::invalid_argument("bigint string contains non-digit characters");
-            digits.push_back(str[i] - '0');
+        std::ios_base::iostate state = traits::eq_int_type(c, traits::eof()) ? std::ios_base::eofbit
+                                                                             : std::ios_base::goodbit;
+        if (blocks.parts.empty() && digits.empty()) {
+            state |= std::ios_base::failbit;
+        } else {
+            value = finish_decimal_blocks(blocks, digits.data(), digits.size());
+            value.is_negative = negative && !value.limbs.empty();
+        }
+        is.setstate(state);
+        return is;
+    }
+
+    /**
+     * @brief Reads a number stored as decimal text, optionally surrounded by whitespace,
+     *        from a file.
+     *
+     *        The file is read through operator>>, so the text is never held in full.
+     *        The memory used peaks at about four to five times the size of the binary
+     *        value, in the multiplications that merge the longest blocks of digits.
+     *
+     * @param path The file to read.
+     * @return The number held by the file.
+     * @throw std::ios_base::failure Throws an exception if the file cannot be read.
+     * @throw std::invalid_argument Throws an exception if the file does not hold a decimal number.
+     */
+    static bigint read_file(const std::filesystem::path& path) {
+        std::ifstream in(path, std::ios_base::binary);
+        if (!in) bigint_detail::file_error("bigint cannot open", path, errno);
+        bigint value;
+        if (!(in >> value) || !(in >> std::ws).eof()) {
+            throw std::invalid_argument("bigint file does not hold a decimal number");
+        }
+        return value;
+    }
+
+    /**
+     * @brief Writes the number as decimal text to a file, replacing its contents.
+     *
+     *        The digits are produced part by part through a buffer of
+     *        BIGINT_STREAM_BUFFER_BYTES characters, as operator<< does for numbers of more
+     *        than that many digits, so the text is never held in full.
+     *
+     * @param path The file to write.
+     * @throw std::ios_base::failure Throws an exception if the file cannot be written.
+     */
+    void write_file(const std::filesystem::path& path) const {
+        std::ofstream out(path, std::ios_base::binary | std::ios_base::trunc);
+        if (!out) bigint_detail::file_error("bigint cannot create", path, errno);
+        write_stream(out);
+        out.close();
+        if (!out) bigint_detail::file_error("bigint cannot write", path, errno);
+    }
+
+    /**
+     * @brief Unary negation operator for the bigint class.
+     *        Creates a new bigint object with its sign inverted, unless it
+     *        represents zero.
+     *
+     * @return A new bigint object with the sign inverted if the value is non-zero,
+     *         otherwise, returns a bigint object representing zero with no sign change.
+     */
+    constexpr bigint operator-() const& {
+        bigint temp = *this;
+        if (!temp.limbs.empty()) temp.is_negative = !is_negative;
+        return temp;
+    }
+
+    /**
+     * @brief Unary negation of an expiring bigint, flipping the sign of its own storage
+     *        instead of copying it.
+     *
+     * @return The negated value, owning the limbs of the operand.
+     */
+    constexpr bigint operator-() && {
+        if (!limbs.empty()) is_negative = !is_negative;
+        return std::move(*this);
+    }
+
+    /**
+     * @brief Subtraction with an expiring left operand, which is updated in place and
+     *        returned so that its limb storage is reused for the result.
+     */
+    friend constexpr bigint operator-(bigint&& lhs, const bigint& rhs) {
+        lhs -= rhs;
+        return std::move(lhs);
+    }
+
+    /**
+     * @brief Subtraction with an expiring right operand, computed as -(rhs - lhs) in the
+     *        storage of rhs.
+     */
+    friend constexpr bigint operator-(const bigint& lhs, bigint&& rhs) {
+        rhs -= lhs;
+        if (!rhs.limbs.empty()) rhs.is_negative = !rhs.is_negative;
+        return std::move(rhs);
+    }
+
+    /**
+     * @brief Subtraction of two expiring operands, reusing the storage of the left one.
+     */
+    friend constexpr bigint operator-(bigint&& lhs, bigint&& rhs) {
+        lhs -= rhs;
+        return std::move(lhs);
+    }
+
+    /**
+     * @brief Subtracts the given bigint from the current bigint and updates the current bigint.
+     *
+     * The difference is formed directly in the limbs of the current object, reusing
+     * their capacity, so no temporary bigint is created.
+     *
+     * @param value The bigint object to be subtracted from the current object.
+     * @return A reference to the modified bigint object after performing the subtraction.
+     */
+    constexpr bigint& operator-=(const bigint& value) {
+        if (&value == this) {
+            limbs.clear();
+            is_negative = false;
+        } else if (is_negative != value.is_negative) {
+            add_magnitude(value.limbs.data(), value.limbs.size());
+        } else {
+            subtract_magnitude(value.limbs.data(), value.limbs.size());
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Subtracts the value of an expression in place, term by term, with
+     *        products multiply-subtracted from the current limbs.
+     *
+     * @param expr The expression built by +, - or * on bigint operands.
+     * @return A reference to the updated bigint object.
+     */
+    template <typename Op, typename L, typename R>
+    constexpr bigint& operator-=(const bigint_detail::bigint_expr<Op, L, R>& expr) {
+        if (refers_to(expr, this)) return *this -= bigint(expr);
+        if constexpr (std::is_same_v<Op, bigint_detail::mul_op>) {
+            accumulate(expr, true);
+        } else {
+            *this -= expr.lhs;
+            if constexpr (std::is_same_v<Op, bigint_detail::add_op>) {
+                *this -= expr.rhs;
+            } else {
+                *this += expr.rhs;
+            }
         }
-        std::ranges::reverse(digits);
-        remove_leading_zeros();
+        return *this;
     }
 
-private:
     /**
-     * @brief Stores the individual digits of a large integer.
-     *        This container holds each digit of the large integer as
-     *        separate elements, allowing for efficient manipulation
-     *        and operations on the number. The digits are typically
-     *        stored in a specific order (e.g., the least significant digit
-     *        first), depending on the implementation.
+     * @brief Addition with an expiring left operand, which is updated in place and
+     *        returned so that its limb storage is reused for the result.
      */
-    std::vector<int64_t> digits;
+    friend constexpr bigint operator+(bigint&& lhs, const bigint& rhs) {
+        lhs += rhs;
+        return std::move(lhs);
+    }
 
     /**
-     * @brief Boolean flag indicating whether the number is negative.
-     *        Represents the sign of a number, where true denotes a negative
-     *        value and false indicates a non-negative value.
+     * @brief Addition with an expiring right operand, reusing its limb storage.
      */
-    bool is_negative;
+    friend constexpr bigint operator+(const bigint& lhs, bigint&& rhs) {
+        rhs += lhs;
+        return std::move(rhs);
+    }
 
     /**
-     * @brief Removes leading zeros from the digits vector of the bigint object.
-     *        Ensures that the bigint representation is normalized.
-     *
-     *        This method iteratively removes any trailing zeros in the digits vector,
-     *        leaving only the most significant digits. If the resulting bigint has a
-     *        value of zero (i.e., only one digit remaining which is 0), the is_negative
-     *        flag is set too false to represent a non-negative zero.
+     * @brief Addition of two expiring operands, reusing the storage of the left one.
      */
-    void remove_leading_zeros() {
-        while (digits.size() > 1 && digits.back() == 0) {
-            digits.pop_back();
-        }
-        if (digits.size() == 1 && digits[0] == 0) is_negative = false;
+    friend constexpr bigint operator+(bigint&& lhs, bigint&& rhs) {
+        lhs += rhs;
+        return std::move(lhs);
     }
 
     /**
-     * @brief Computes the sum of absolute values of the current bigint and the provided bigint.
-     *        This method assumes that both numbers are treated as non-negative regardless
-     *        of their actual sign and returns the result with the same sign as the current bigint.
+     * @brief Overloads the += operator for the bigint class to add another bigint.
+     *        This updates the current bigint object by adding the provided bigint value.
      *
-     * @param value A reference to the bigint object that is to be added to the current object.
-     * @return A bigint object representing the sum of the absolute values of the two bigints,
-     *         with the same sign as the current bigint.
+     *        The sum is formed directly in the limbs of the current object, reusing
+     *        their capacity, so no temporary bigint is created.
+     *
+     * @param value The bigint to be added to the current bigint object.
+     * @return A reference to the updated bigint object after addition.
      */
-    [[nodiscard]] bigint add_absolute_values(const bigint& value) const {
-        bigint result;
-        result.digits.pop_back();
-        result.is_negative = is_negative;
-        int64_t carry = 0, sum = 0;
-        const size_t max_size = std::max(digits.size(), value.digits.size());
-        result.digits.resize(max_size);
-
-        for (size_t i = 0; i < max_size; ++i) {
-            sum = carry;
-            if (i < digits.size()) sum += digits[i];
-            if (i < value.digits.size()) sum += value.digits[i];
-            carry = sum / 10;
-            result.digits[i] = sum % 10;
-        }
-        if (carry != 0) result.digits.push_back(carry);
-        return result;
+    constexpr bigint& operator+=(const bigint& value) {
+        if (&value == this) {
+            shift_left_bits(1);
+        } else if (is_negative == value.is_negative) {
+            add_magnitude(value.limbs.data(), value.limbs.size());
+        } else {
+            subtract_magnitude(value.limbs.data(), value.limbs.size());
+        }
+        return *this;
     }
 
     /**
-     * @brief Subtracts the absolute values of the current bigint object
-     *        and another bigint object, ignoring their signs, and
-     *        returns the result as a new bigint.
+     * @brief Adds the value of an expression in place. Sums and differences are
+     *        applied term by term, and products are multiply-accumulated into the
+     *        current limbs, so sum += a * b forms no intermediate bigint.
      *
-     *        This method computes the difference between the magnitudes
-     *        of the numbers and assigns the appropriate sign to the result
-     *        based on their relative magnitudes and original signs.
-     *
-     * @param value The bigint object whose absolute value will be subtracted
-     *              from the absolute value of the current bigint object.
-     * @return A bigint object representing the result of the subtraction
-     *         of the absolute values, with the correct sign.
+     * @param expr The expression built by +, - or * on bigint operands.
+     * @return A reference to the updated bigint object.
      */
-    [[nodiscard]] bigint subtract_absolute_values(const bigint& value) const {
-        bigint result;
-        result.digits.pop_back();
-        const bool is_value_larger = abs_values_larger(value);
-        result.is_negative = (value.is_negative and is_value_larger) or (*this < value and not is_value_larger);
-        const std::vector<int64_t>& abs_larger = (is_value_larger ? value.digits : digits);
-        const std::vector<int64_t>& abs_smaller = (is_value_larger ? digits : value.digits);
-        int borrow = 0;
-
-        for (size_t i = 0; i < abs_larger.size(); ++i) {
-            int64_t diff = abs_larger[i] - borrow - (i < abs_smaller.size() ? abs_smaller[i] : 0);
-            if (diff < 0) {
-                diff += 10;
-                borrow = 1;
+    template <typename Op, typename L, typename R>
+    constexpr bigint& operator+=(const bigint_detail::bigint_expr<Op, L, R>& expr) {
+        if (refers_to(expr, this)) return *this += bigint(expr);
+        if constexpr (std::is_same_v<Op, bigint_detail::mul_op>) {
+            accumulate(expr, false);
+        } else {
+            *this += expr.lhs;
+            if constexpr (std::is_same_v<Op, bigint_detail::add_op>) {
+                *this += expr.rhs;
             } else {
-                borrow = 0;
+                *this -= expr.rhs;
             }
-            result.digits.push_back(diff);
         }
-        result.remove_leading_zeros();
-        return result;
+        return *this;
+    }
+
+    /**
+     * @brief Compound assignment operator for multiplying this bigint by another bigint.
+     *        Multiplies the current bigint by the provided bigint and assigns the result
+     *        to the current bigint.
+     *
+     * @param other The bigint instance to multiply with the current bigint.
+     * @return A reference to the current bigint after multiplication.
+     */
+    constexpr bigint& operator*=(const bigint& other) {
+        *this = *this * other;
+        return *this;
     }
 
     /**
-     * @brief Multiplies the absolute values of the current bigint object
-     *        and another bigint object without considering their signs.
+     * @brief Squares a bigint.
      *
-     *        This method calculates the product of the digits of the two bigints
-     *        as if they were positive numbers and stores the result in a new
-     *        bigint object. Any leading zeros in the result are removed.
+     *        Equivalent to value * value, which also takes this path: squaring needs
+     *        only about half the partial products of a general multiplication at the
+     *        schoolbook and Karatsuba tiers, fewer point evaluations for Toom-Cook and a
+     *        single forward transform for the NTT.
      *
-     * @param value The bigint object whose absolute value is multiplied
-     *              with the absolute value of the current bigint.
-     * @return A new bigint object representing the product of the
-     *         absolute values of the two bigints.
+     * @param value The bigint to square.
+     * @return The square of value.
      */
-    [[nodiscard]] bigint multiply_absolute_values(const bigint& value) const {
+    friend constexpr bigint square(const bigint& value) {
         bigint result;
-        result.digits.pop_back();
-        result.digits.resize(digits.size() + value.digits.size(), 0);
-
-        for (size_t i = 0; i < digits.size(); ++i) {
-            int64_t carry = 0;
-            for (size_t j = 0; j < value.digits.size() || carry; ++j) {
-                const int64_t current = result.digits[i + j] + digits[i] * (j < value.digits.size() ? value.digits[j] : 0) + carry;
-                result.digits[i + j] = current % 10;
-                carry = current / 10;
-            }
-        }
-        result.remove_leading_zeros();
+        result.assign_product(value, value);
         return result;
     }
 
     /**
-     * @brief Compares the absolute values of the current bigint object
-     *        with another bigint object to determine which is larger.
+     * @brief Raises a bigint to a power by left-to-right binary exponentiation, one
+     *        squaring per exponent bit plus a multiplication by base per set bit.
      *
-     * @param value The bigint object to compare against.
-     * @return True if the absolute value of the provided bigint object is larger
-     *         than the absolute value of the current bigint object, false otherwise.
+     * @param base The base, of any sign.
+     * @param exp The exponent; pow(base, 0) is 1 for every base, zero included.
+     * @return base^exp.
      */
-    [[nodiscard]] bool abs_values_larger(const bigint& value) const {
-        if (digits.size() < value.digits.size()) return true;
-        if (digits.size() > value.digits.size()) return false;
-        for (size_t i = digits.size() - 1; i > 0; --i) {
-            if (digits[i] != value.digits[i]) {
-                return digits[i] < value.digits[i];
+    friend constexpr bigint pow(const bigint& base, uint64_t exp) {
+        bigint result(1);
+        if (exp == 0) return result;
+        result = base;
+        bigint next;
+        for (int bit = static_cast<int>(std::bit_width(exp)) - 2; bit >= 0; --bit) {
+            next.assign_product(result, result);
+            std::swap(result, next);
+            if ((exp >> bit) & 1) {
+                next.assign_product(result, base);
+                std::swap(result, next);
             }
         }
-        return digits[0] < value.digits[0];
+        return result;
     }
 
-public:
     /**
-     * @brief Equality operator for comparing two bigint objects.
-     *        Checks if both the is_negative flag and the digits of the
-     *        two bigint objects are identical.
+     * @brief Computes base^exp mod |mod|, the result lying in [0, |mod|).
      *
-     * @param value The bigint object to compare with the current instance.
-     * @return true if both bigint objects are equal, otherwise false.
+     *        Uses sliding-window exponentiation. Odd moduli below
+     *        bigint::tuning().powmod_division limbs work in Montgomery form, where
+     *        reduction needs no division; even and larger moduli reduce each product
+     *        by division.
+     *
+     * @param base The base, of any sign.
+     * @param exp The exponent, which must not be negative.
+     * @param mod The modulus, which must not be zero.
+     * @return The residue of base^exp.
+     * @throw std::domain_error Throws an exception if mod is zero or exp is negative.
      */
-    bool operator==(const bigint & value) const {
-        return is_negative == value.is_negative && digits == value.digits;
+    static bigint powmod(const bigint& base, const bigint& exp, const bigint& mod) {
+        if (mod.limbs.empty()) throw std::domain_error("bigint powmod with zero modulus");
+        if (exp.is_negative) throw std::domain_error("bigint powmod with negative exponent");
+        const bigint_detail::operation_timer timer(bigint_detail::operation_kind::powmod, mod.limbs.size());
+        bigint m = mod;
+        m.is_negative = false;
+        if (m.limbs.size() == 1 && m.limbs[0] == 1) return bigint();
+        if (exp.limbs.empty()) return bigint(1);
+
+        bigint x = base % m;
+        if (x.is_negative) x += m;
+        if ((m.limbs[0] & 1) != 0 && m.limbs.size() < bigint_detail::tuning.powmod_division) {
+            bigint_detail::count_algorithm(bigint_detail::algorithm_kind::powmod_montgomery);
+            return powmod_montgomery(x, exp, m);
+        }
+        bigint_detail::count_algorithm(bigint_detail::algorithm_kind::powmod_division);
+        sliding_window_pow(x, exp,
+                           [&m](bigint& value) {
+                               value = value * value;
+                               value %= m;
+                           },
+                           [&m](bigint& value, const bigint& factor) {
+                               value = value * factor;
+                               value %= m;
+                           });
+        return x;
     }
 
     /**
-     * @brief Inequality operator for comparing two bigint objects.
-     *        Determines if the current bigint object is not equal to the given bigint object.
+     * @brief Multiplies all elements of a range by a balanced product tree.
      *
-     * @param value The bigint object to compare with the current object.
-     * @return True if the current bigint object is not equal to the given bigint object,
-     *         otherwise false.
+     *        Built-in integers are packed several to a limb before the tree is built,
+     *        so a range of small numbers starts from few, full-limb leaves.
+     *
+     * @param range bigints, expressions or built-in integers.
+     * @return The product of the elements, 1 for an empty range.
      */
-    bool operator!=(const bigint & value) const {
-        return !(*this == value);
+    template <std::ranges::input_range R>
+        requires std::constructible_from<bigint, std::ranges::range_reference_t<R>>
+    static bigint product(R&& range) {
+        using value_type = std::remove_cvref_t<std::ranges::range_reference_t<R>>;
+        if constexpr (bigint_detail::native_integer<value_type>) {
+            bigint_detail::scratch_vector<limb_t> factors;
+            bool negative = false;
+            for (const value_type value : range) {
+                factors.push_back(native_magnitude(value));
+                negative = negative != std::cmp_less(value, 0);
+            }
+            bigint result = product_of_limbs(factors);
+            result.is_negative = negative && !result.limbs.empty();
+            return result;
+        } else {
+            bigint_vector values;
+            for (auto&& value : range) values.emplace_back(std::forward<decltype(value)>(value));
+            return product_tree(values);
+        }
     }
 
     /**
-     * @brief Overloads the `<` operator to compare two bigint objects.
-     *        Determines whether the current bigint object is less than
-     *        the given bigint object.
+     * @brief Adds up all elements of a range.
      *
-     * @param value The bigint object to compare against.
-     * @return True if the current bigint object is less than the given
-     *         bigint object, otherwise False.
+     *        Unlike products, sums gain nothing from a tree: an in-place addition costs
+     *        the length of its operands, so accumulating into one value that grows by at
+     *        most a few limbs is linear in the total input, while every level of a tree
+     *        would pass over all of it again.
+     *
+     * @param range bigints, expressions or built-in integers.
+     * @return The sum of the elements, 0 for an empty range.
      */
-    bool operator<(const bigint & value) const {
-        if (is_negative != value.is_negative) return is_negative;
-        if (digits.size() != value.digits.size()) {
-            return is_negative ? digits.size() > value.digits.size() : digits.size() < value.digits.size();
-        }
-        for (size_t i = digits.size() - 1; i > 0; --i) {
-            if (digits[i] != value.digits[i]) {
-                return is_negative ? digits[i] > value.digits[i] : digits[i] < value.digits[i];
-            }
-        }
-        return digits[0] < value.digits[0];
+    template <std::ranges::input_range R>
+        requires requires(bigint& total, std::ranges::range_reference_t<R> value) { total += value; }
+    static bigint sum(R&& range) {
+        bigint total;
+        for (auto&& value : range) total += value;
+        return total;
     }
 
     /**
-     * @brief Overloaded greater-than operator for comparing two bigint objects.
+     * @brief Computes n! by the prime swing method.
      *
-     *        Compares the current bigint object with another bigint object to determine
-     *        if the current object is greater.
+     *        n! is the square of (n / 2)! times the swing n! / ((n / 2)!)^2, whose prime
+     *        factorization is read off n directly and multiplied out by a product tree.
+     *        Powers of two are left out throughout and restored by a single shift.
      *
-     * @param value A reference to the bigint object being compared to the current object.
-     *
-     * @return True if the current bigint object is greater than the provided bigint object,
-     *         otherwise false.
+     * @param n The argument.
+     * @return n!.
      */
-    bool operator>(const bigint & value) const {
-        return value < *this;
+    static bigint factorial(uint64_t n) {
+        bigint result = odd_factorial(n, bigint_detail::odd_primes(n));
+        result.shift_left_bits(n - static_cast<uint64_t>(std::popcount(n)));
+        return result;
     }
 
     /**
-     * @brief Compares the current bigint object with the given bigint object
-     *        to determine if it is greater than or equal to the other.
+     * @brief Computes the binomial coefficient n choose k.
      *
-     * @param value The bigint object to compare against.
-     * @return True if the current object is greater than or equal to the given bigint object,
-     *         otherwise false.
+     *        For k small against n, the product (n - k + 1) ... n is divided by k!.
+     *        Otherwise each prime up to n is raised to its exponent in the coefficient,
+     *        the number of carries when adding k and n - k in base p, and the powers are
+     *        multiplied by a product tree.
+     *
+     * @return The coefficient, 0 if k exceeds n.
      */
-    bool operator>=(const bigint & value) const {
-        return !(*this < value);
+    static bigint binomial(uint64_t n, uint64_t k) {
+        if (k > n) return bigint();
+        k = std::min(k, n - k);
+        bigint_detail::scratch_vector<limb_t> factors;
+        if (k < n / 256) {
+            // Counted down from n, so that n = UINT64_MAX cannot wrap the loop variable.
+            for (uint64_t j = 0; j < k; ++j) factors.push_back(n - j);
+            return product_of_limbs(factors) / factorial(k);
+        }
+        for (const limb_t p : bigint_detail::odd_primes(n)) {
+            if (p > n - k) {
+                factors.push_back(p);
+            } else if (p <= n / 2) {
+                limb_t power = 1;
+                for (uint64_t nq = n / p, kq = k / p, rq = (n - k) / p; nq > 0; nq /= p, kq /= p, rq /= p) {
+                    if (nq != kq + rq) power *= p;
+                }
+                if (power != 1) factors.push_back(power);
+            }
+        }
+        bigint result = product_of_limbs(factors);
+        result.shift_left_bits(static_cast<size_t>(std::popcount(k) + std::popcount(n - k) - std::popcount(n)));
+        return result;
     }
 
     /**
-     * @brief Overloaded less than or equal to operator for bigint comparison.
-     *        Compares the current bigint object with the provided bigint
-     *        to determine if it is less than or equal.
+     * @brief Computes the primorial n#, the product of all primes up to n.
      *
-     * @param value A constant reference to the bigint object to compare with.
-     * @return True if the current bigint object is less than or equal
-     *         to the provided bigint, otherwise false.
+     * @return n#, 1 for n below 2.
      */
-    bool operator<=(const bigint & value) const {
-        return value >= *this;
+    static bigint primorial(uint64_t n) {
+        if (n < 2) return bigint(1);
+        bigint_detail::scratch_vector<limb_t> factors = bigint_detail::odd_primes(n);
+        factors.push_back(2);
+        return product_of_limbs(factors);
     }
 
     /**
-     * @brief Overloads the comparison or arithmetic operator for a custom object,
-     *        enabling the implementation of specific behaviors for the operator
-     *        based on the object's type.
+     * @brief Overloads the division operator for the bigint class.
      *
-     *        This operator allows for custom comparison or calculations
-     *        involving the instances of the class.
+     *        The quotient is truncated towards zero, as for the built-in integer types.
+     *        Divisors of up to one limb use a single pass of hardware division, longer
+     *        ones algorithm D and, from bigint::tuning().div_burnikel_ziegler limbs, the
+     *        recursive Burnikel-Ziegler method whose cost follows that of multiplication.
      *
-     * @param num The object or value with which the current object is being compared
-     *              or combined through the overloaded operator.
-     * @return The result of applying the operator, which may vary depending on
-     *         the operator's implementation (e.g., a boolean, a numeric value, or another object).
+     * @param lhs The dividend.
+     * @param rhs The divisor.
+     * @return The quotient lhs / rhs.
+     * @throw std::domain_error Throws an exception if rhs is zero.
      */
-    friend std::ostream& operator<<(std::ostream& os, const bigint& num) {
-        if (num.is_negative) os << '-';
-        for (const int64_t digit : std::ranges::reverse_view(num.digits)) {
-            os << digit;
-        }
-        return os;
+    friend bigint operator/(const bigint& lhs, const bigint& rhs) {
+        bigint quotient;
+        divide(lhs, rhs, &quotient, nullptr);
+        return quotient;
     }
 
     /**
-     * @brief Unary negation operator for the bigint class.
-     *        Creates a new bigint object with its sign inverted, unless it
-     *        represents zero.
+     * @brief Overloads the modulo operator for the bigint class. The remainder takes
+     *        the sign of the dividend, so that (lhs / rhs) * rhs + lhs % rhs == lhs.
      *
-     * @return A new bigint object with the sign inverted if the value is non-zero,
-     *         otherwise, returns a bigint object representing zero with no sign change.
+     * @param lhs The dividend.
+     * @param rhs The divisor.
+     * @return The remainder of lhs / rhs.
+     * @throw std::domain_error Throws an exception if rhs is zero.
      */
-    bigint operator-() const {
-        bigint temp = *this;
-        if (temp.digits.size() > 1 or (temp.digits.size() == 1 and temp.digits[0] != 0)) temp.is_negative = !is_negative;
-        return temp;
+    friend bigint operator%(const bigint& lhs, const bigint& rhs) {
+        bigint remainder;
+        divide(lhs, rhs, nullptr, &remainder);
+        return remainder;
     }
 
     /**
-     * @brief Overloaded subtraction operator for bigint.
-     *        Computes the result of subtracting the given bigint
-     *        value from the current bigint instance.
+     * @brief Divides the current bigint by another bigint and stores the truncated quotient.
      *
-     * @param value The bigint instance to be subtracted from
-     *              the current bigint.
-     * @return A new bigint instance representing the result
-     *         of the subtraction operation.
+     * @param value The divisor.
+     * @return A reference to the current bigint after division.
+     * @throw std::domain_error Throws an exception if value is zero.
      */
-    bigint operator-(const bigint& value) const {
-        bigint result;
-        result.digits.pop_back();
-        if (is_negative != value.is_negative) {
-            result = add_absolute_values(value);
-            result.is_negative = is_negative;
-        } else {
-            result = subtract_absolute_values(-value);
-        }
-        result.remove_leading_zeros();
-        return result;
+    bigint& operator/=(const bigint& value) {
+        divide(*this, value, this, nullptr);
+        return *this;
     }
 
     /**
-     * @brief Subtracts the given bigint from the current bigint and updates the current bigint.
-     *
-     * Performs subtraction by using the overloaded subtraction operator and assigns
-     * the result back to the current bigint object.
+     * @brief Replaces the current bigint by its remainder modulo another bigint.
      *
-     * @param value The bigint object to be subtracted from the current object.
-     * @return A reference to the modified bigint object after performing the subtraction.
+     * @param value The divisor.
+     * @return A reference to the current bigint after the operation.
+     * @throw std::domain_error Throws an exception if value is zero.
      */
-    bigint& operator-=(const bigint& value) {
-        *this = *this - value;
+    bigint& operator%=(const bigint& value) {
+        divide(*this, value, nullptr, this);
         return *this;
     }
 
     /**
-     * @brief Overloads the addition operator for the bigint class.
-     *        Computes the sum of the current bigint and the provided bigint.
+     * @brief Computes the quotient and the remainder of a division in a single pass.
      *
-     * @param value A constant reference to a bigint object to be added to the current object.
-     * @return A new bigint object that represents the result of the addition.
-     *         Maintains proper sign handling based on the input values.
+     * @param lhs The dividend.
+     * @param rhs The divisor.
+     * @return The pair (lhs / rhs, lhs % rhs).
+     * @throw std::domain_error Throws an exception if rhs is zero.
      */
-    bigint operator+(const bigint& value) const {
-        bigint result;
-        result.digits.pop_back();
-        if (is_negative == value.is_negative) {
-            result = add_absolute_values(value);
-        } else {
-            result = subtract_absolute_values(value);
-        }
+    friend std::pair<bigint, bigint> divmod(const bigint& lhs, const bigint& rhs) {
+        std::pair<bigint, bigint> result;
+        divide(lhs, rhs, &result.first, &result.second);
         return result;
     }
 
     /**
-     * @brief Overloads the += operator for the bigint class to add another bigint.
-     *        This updates the current bigint object by adding the provided bigint value.
+     * @brief Arithmetic with a built-in integer on either side. The integer is used
+     *        directly as a single limb: addition and subtraction stop as soon as the
+     *        carry or borrow is absorbed, multiplication and division make one pass
+     *        over the limbs, and no bigint is built for the integer. A bigint operand
+     *        passed as an rvalue is updated in place.
      *
-     * @param value The bigint to be added to the current bigint object.
-     * @return A reference to the updated bigint object after addition.
+     * @param lhs The left operand.
+     * @param rhs The right operand.
+     * @return The sum, difference, product, truncated quotient or remainder.
+     * @throw std::domain_error The division and remainder operators throw if the
+     *                          divisor is zero.
      */
-    bigint& operator+=(const bigint& value) {
-        *this = *this + value;
-        return *this;
+    template <bigint_detail::native_integer T>
+    friend constexpr bigint operator+(bigint lhs, T rhs) {
+        lhs.add_limb(native_magnitude(rhs), std::cmp_less(rhs, 0));
+        return lhs;
     }
 
-    /**
-     * @brief Overloaded multiplication operator for the bigint class.
-     *        Computes the product of the current bigint object and the given bigint value.
-     *
-     * @param value The bigint object to be multiplied with the current object.
-     * @return A new bigint object representing the product of the two bigint values.
-     *         The resulting sign (positive or negative) is computed based on the signs
-     *         of the operands.
-     */
-    bigint operator*(const bigint& value) const {
-        bigint result = multiply_absolute_values(value);
-        result.is_negative = (is_negative != value.is_negative);
-        return result;
+    template <bigint_detail::native_integer T>
+    friend constexpr bigint operator+(T lhs, bigint rhs) {
+        rhs.add_limb(native_magnitude(lhs), std::cmp_less(lhs, 0));
+        return rhs;
+    }
+
+    template <bigint_detail::native_integer T>
+    friend constexpr bigint operator-(bigint lhs, T rhs) {
+        lhs.add_limb(native_magnitude(rhs), std::cmp_greater(rhs, 0));
+        return lhs;
+    }
+
+    template <bigint_detail::native_integer T>
+    friend constexpr bigint operator-(T lhs, bigint rhs) {
+        if (!rhs.limbs.empty()) rhs.is_negative = !rhs.is_negative;
+        rhs.add_limb(native_magnitude(lhs), std::cmp_less(lhs, 0));
+        return rhs;
+    }
+
+    template <bigint_detail::native_integer T>
+    friend constexpr bigint operator*(bigint lhs, T rhs) {
+        lhs.multiply_limb(native_magnitude(rhs), std::cmp_less(rhs, 0));
+        return lhs;
+    }
+
+    template <bigint_detail::native_integer T>
+    friend constexpr bigint operator*(T lhs, bigint rhs) {
+        rhs.multiply_limb(native_magnitude(lhs), std::cmp_less(lhs, 0));
+        return rhs;
+    }
+
+    template <bigint_detail::native_integer T>
+    friend constexpr bigint operator/(bigint lhs, T rhs) {
+        lhs.divide_limb(native_magnitude(rhs), std::cmp_less(rhs, 0));
+        return lhs;
+    }
+
+    template <bigint_detail::native_integer T>
+    friend bigint operator/(T lhs, const bigint& rhs) {
+        bigint quotient(lhs);
+        quotient /= rhs;
+        return quotient;
+    }
+
+    template <bigint_detail::native_integer T>
+    friend constexpr bigint operator%(bigint lhs, T rhs) {
+        lhs %= rhs;
+        return lhs;
+    }
+
+    template <bigint_detail::native_integer T>
+    friend bigint operator%(T lhs, const bigint& rhs) {
+        bigint remainder(lhs);
+        remainder %= rhs;
+        return remainder;
     }
 
     /**
-     * @brief Compound assignment operator for multiplying this bigint by another bigint.
-     *        Multiplies the current bigint by the provided bigint and assigns the result
-     *        to the current bigint.
+     * @brief Compound assignment with a built-in integer, in place and without
+     *        building a bigint for the integer.
      *
-     * @param other The bigint instance to multiply with the current bigint.
-     * @return A reference to the current bigint after multiplication.
+     * @param value The right operand.
+     * @return A reference to the current bigint after the operation.
+     * @throw std::domain_error /= and %= throw if value is zero.
      */
-    bigint& operator*=(const bigint& other) {
-        *this = *this * other;
+    template <bigint_detail::native_integer T>
+    constexpr bigint& operator+=(T value) {
+        add_limb(native_magnitude(value), std::cmp_less(value, 0));
+        return *this;
+    }
+
+    template <bigint_detail::native_integer T>
+    constexpr bigint& operator-=(T value) {
+        add_limb(native_magnitude(value), std::cmp_greater(value, 0));
+        return *this;
+    }
+
+    template <bigint_detail::native_integer T>
+    constexpr bigint& operator*=(T value) {
+        multiply_limb(native_magnitude(value), std::cmp_less(value, 0));
+        return *this;
+    }
+
+    template <bigint_detail::native_integer T>
+    constexpr bigint& operator/=(T value) {
+        divide_limb(native_magnitude(value), std::cmp_less(value, 0));
+        return *this;
+    }
+
+    template <bigint_detail::native_integer T>
+    constexpr bigint& operator%=(T value) {
+        const bool negative = is_negative;
+        const limb_t remainder = divide_limb(native_magnitude(value), std::cmp_less(value, 0));
+        limbs.clear();
+        if (remainder != 0) limbs.push_back(remainder);
+        is_negative = negative && remainder != 0;
         return *this;
     }
 
     /**
      * @brief Pre-increment operator to increase the value of the current bigint object by one.
      *
-     *        This operator modifies the current bigint object by adding 1 to its value.
+     *        This operator modifies the current bigint object by adding 1 to its value
+     *        in place, touching only the limbs the carry propagates into.
      *
      * @return A reference to the current bigint object after incrementing its value.
      */
-    bigint& operator++() {
-        *this = *this + bigint(1);
+    constexpr bigint& operator++() {
+        if (is_negative) {
+            decrement_magnitude();
+        } else {
+            increment_magnitude();
+        }
         return *this;
     }
 
@@ -458,7 +4889,7 @@ public:
      *
      * @return A copy of the bigint object as it was before the increment.
      */
-    bigint operator++(int) {
+    constexpr bigint operator++(int) {
         bigint temp = *this;
         ++(*this);
         return temp;
@@ -468,12 +4899,18 @@ public:
      * @brief Decrements the current bigint object by 1 and returns a reference to it.
      *
      *        This method reduces the value of the current bigint object by a unit
-     *        and updates it in place. The operation modifies the original object.
+     *        and updates it in place, touching only the limbs the borrow propagates
+     *        into. The operation modifies the original object.
      *
      * @return A reference to the current bigint object after decrementing its value.
      */
-    bigint& operator--() {
-        *this = *this - bigint(1);
+    constexpr bigint& operator--() {
+        if (is_negative || limbs.empty()) {
+            increment_magnitude();
+            is_negative = true;
+        } else {
+            decrement_magnitude();
+        }
         return *this;
     }
 
@@ -487,11 +4924,320 @@ public:
      * @return A bigint object that represents the value of the current bigint
      *         object before the decrement operation.
      */
-    bigint operator--(int) {
+    constexpr bigint operator--(int) {
         bigint temp = *this;
         --(*this);
         return temp;
     }
 };
 
-#endif
\ No newline at end of file
+/**
+ * @brief Negates an expression, evaluating it first.
+ *
+ * @param expr The expression to negate.
+ * @return The negated value.
+ */
+template <typename Op, typename L, typename R>
+constexpr bigint operator-(const bigint_detail::bigint_expr<Op, L, R>& expr) {
+    return -bigint(expr);
+}
+
+/**
+ * @brief Adds an expression to an expiring bigint, evaluating it into the bigint's storage.
+ *        These overloads also keep such mixed operands from being ambiguous between the
+ *        expression operators and the rvalue overloads.
+ *
+ * @param lhs The expiring bigint.
+ * @param rhs The expression to add.
+ * @return The sum, which owns the storage of lhs.
+ */
+template <typename Op, typename L, typename R>
+constexpr bigint operator+(bigint&& lhs, const bigint_detail::bigint_expr<Op, L, R>& rhs) {
+    lhs += rhs;
+    return std::move(lhs);
+}
+
+/**
+ * @brief Adds an expiring bigint to an expression, evaluating it into the bigint's storage.
+ *
+ * @param lhs The expression to add.
+ * @param rhs The expiring bigint.
+ * @return The sum, which owns the storage of rhs.
+ */
+template <typename Op, typename L, typename R>
+constexpr bigint operator+(const bigint_detail::bigint_expr<Op, L, R>& lhs, bigint&& rhs) {
+    rhs += lhs;
+    return std::move(rhs);
+}
+
+/**
+ * @brief Subtracts an expression from an expiring bigint in the bigint's storage.
+ *
+ * @param lhs The expiring bigint.
+ * @param rhs The expression to subtract.
+ * @return The difference, which owns the storage of lhs.
+ */
+template <typename Op, typename L, typename R>
+constexpr bigint operator-(bigint&& lhs, const bigint_detail::bigint_expr<Op, L, R>& rhs) {
+    lhs -= rhs;
+    return std::move(lhs);
+}
+
+/**
+ * @brief Subtracts an expiring bigint from an expression, computed as -(rhs - lhs)
+ *        in the bigint's storage.
+ *
+ * @param lhs The expression to subtract from.
+ * @param rhs The expiring bigint.
+ * @return The difference, which owns the storage of rhs.
+ */
+template <typename Op, typename L, typename R>
+constexpr bigint operator-(const bigint_detail::bigint_expr<Op, L, R>& lhs, bigint&& rhs) {
+    rhs -= lhs;
+    return -std::move(rhs);
+}
+
+/**
+ * @brief Integer literal of any length, converted to limbs at compile time.
+ *
+ *        123456789012345678901234567890_big, 0xffff'ffff'ffff'ffff'ffff_big and the
+ *        binary and octal forms are parsed by the compiler; at run time the literal
+ *        costs a copy of its limbs. The value can be used in constant expressions, and
+ *        a literal of at most BIGINT_INLINE_LIMBS limbs can initialize a constexpr bigint.
+ *
+ * @tparam Chars The characters of the literal.
+ * @return The value of the literal; apply unary - for negative values.
+ */
+template <char... Chars>
+constexpr bigint operator""_big() {
+    const auto& value = bigint_detail::literal_value<Chars...>;
+    return bigint::from_limbs(value.limbs.data(), value.size);
+}
+
+/**
+ * @brief Integer of a fixed width of Bits bits, stored in place without a heap.
+ *
+ *        The value is held in two's complement in a std::array of Bits / 64 limbs, least
+ *        significant first, with no sign flag and no normalization, so a fixed_int is
+ *        trivially copyable and exactly Bits / 8 bytes. Addition and subtraction are
+ *        unrolled into a single carry chain, multiplication forms only the partial
+ *        products of the low half, and from 1024 bits both run on the same dispatched
+ *        kernels as bigint. Results that do not fit either wrap modulo 2^Bits or throw,
+ *        according to Mode.
+ *
+ *        Built-in integers convert implicitly, and bigint converts explicitly in both
+ *        directions by copying the limbs.
+ *
+ * @tparam Bits The width, a positive multiple of 64.
+ * @tparam Signed Whether the top bit is a two's complement sign bit.
+ * @tparam Mode What to do when a result does not fit.
+ */
+template <std::size_t Bits, bool Signed = false, overflow_mode Mode = overflow_mode::wrap>
+class fixed_int {
+public:
+    using limb_t = bigint_detail::limb_t;
+
+    static_assert(Bits > 0 && Bits % bigint_detail::limb_bits == 0, "fixed_int width must be a positive multiple of 64 bits");
+    static constexpr std::size_t limb_count = Bits / bigint_detail::limb_bits;
+
+    constexpr fixed_int() = default;
+
+    /**
+     * @brief Constructs a fixed_int from a built-in integer, sign-extending negative values.
+     *
+     * @param value The value; in checked mode it must be representable.
+     * @throw std::overflow_error In checked mode, if the value does not fit.
+     */
+    template <bigint_detail::native_integer T>
+    constexpr fixed_int(T value) {
+        limbs[0] = static_cast<limb_t>(value);
+        if (std::cmp_less(value, 0)) {
+            std::fill(limbs.begin() + 1, limbs.end(), ~limb_t{0});
+        }
+        if constexpr (Mode == overflow_mode::checked) {
+            if (negative() != std::cmp_less(value, 0)) overflow();
+        }
+    }
+
+    /**
+     * @brief Constructs a fixed_int from a bigint, keeping the low Bits bits of its two's
+     *        complement in wrap mode.
+     *
+     * @param value The value; in checked mode it must be representable.
+     * @throw std::overflow_error In checked mode, if the value does not fit.
+     */
+    explicit constexpr fixed_int(const bigint& value) {
+        const std::size_t n = std::min(value.limbs.size(), limb_count);
+        std::copy_n(value.limbs.data(), n, limbs.data());
+        if (value.is_negative) negate();
+        if constexpr (Mode == overflow_mode::checked) {
+            if (value.limbs.size() > limb_count || (!value.limbs.empty() && negative() != value.is_negative)) {
+                overflow();
+            }
+        }
+    }
+
+    /**
+     * @brief Constructs a fixed_int from a decimal string, as bigint(str) would.
+     *
+     * @throw std::invalid_argument If the string is not a decimal integer.
+     * @throw std::overflow_error In checked mode, if the value does not fit.
+     */
+    explicit constexpr fixed_int(std::string_view str) : fixed_int(bigint(str)) {}
+
+    /**
+     * @brief Converts to a bigint holding the same value.
+     */
+    explicit constexpr operator bigint() const {
+        if (negative()) {
+            fixed_int magnitude = *this;
+            magnitude.negate();
+            bigint result = bigint::from_limbs(magnitude.limbs.data(), limb_count);
+            result.is_negative = true;
+            return result;
+        }
+        return bigint::from_limbs(limbs.data(), limb_count);
+    }
+
+    /**
+     * @brief Returns the limbs of the two's complement representation, least significant first.
+     */
+    [[nodiscard]] constexpr const std::array<limb_t, limb_count>& data() const { return limbs; }
+
+    constexpr fixed_int& operator+=(const fixed_int& other) {
+        const bool lhs_negative = negative();
+        const limb_t carry = bigint_detail::add_fixed<limb_count>(limbs.data(), limbs.data(), other.limbs.data());
+        if constexpr (Mode == overflow_mode::checked) {
+            if (Signed ? lhs_negative == other.negative() && negative() != lhs_negative : carry != 0) overflow();
+        }
+        return *this;
+    }
+
+    constexpr fixed_int& operator-=(const fixed_int& other) {
+        const bool lhs_negative = negative();
+        const limb_t borrow = bigint_detail::sub_fixed<limb_count>(limbs.data(), limbs.data(), other.limbs.data());
+        if constexpr (Mode == overflow_mode::checked) {
+            if (Signed ? lhs_negative != other.negative() && negative() != lhs_negative : borrow != 0) overflow();
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Multiplies in place. Wrap mode forms only the low half of the product;
+     *        checked mode forms the product of the significant limbs of the magnitudes
+     *        and checks that it fits.
+     */
+    constexpr fixed_int& operator*=(const fixed_int& other) {
+        if constexpr (Mode == overflow_mode::checked) {
+            const bool product_negative = negative() != other.negative();
+            fixed_int x = *this;
+            fixed_int y = other;
+            if (x.negative()) x.negate();
+            if (y.negative()) y.negate();
+            const std::size_t xn = x.significant_limbs();
+            const std::size_t yn = y.significant_limbs();
+            limbs = {};
+            if (xn == 0 || yn == 0) return *this;
+            if (xn + yn > limb_count + 1) overflow();
+            std::array<limb_t, 2 * limb_count> wide{};
+            bigint_detail::mul_basecase(wide.data(), x.limbs.data(), xn, y.limbs.data(), yn);
+            if (std::any_of(wide.begin() + limb_count, wide.end(), [](limb_t limb) { return limb != 0; })) overflow();
+            std::copy_n(wide.data(), limb_count, limbs.data());
+            if (product_negative) negate();
+            if (negative() != product_negative) overflow();
+        } else {
+            fixed_int product;
+            bigint_detail::mul_fixed<limb_count>(product.limbs.data(), limbs.data(), other.limbs.data());
+            *this = product;
+        }
+        return *this;
+    }
+
+    friend constexpr fixed_int operator+(fixed_int lhs, const fixed_int& rhs) { return lhs += rhs; }
+    friend constexpr fixed_int operator-(fixed_int lhs, const fixed_int& rhs) { return lhs -= rhs; }
+    friend constexpr fixed_int operator*(fixed_int lhs, const fixed_int& rhs) { return lhs *= rhs; }
+
+    /**
+     * @brief Negates the value. In checked mode the negation of a nonzero unsigned value
+     *        or of the most negative signed value throws std::overflow_error.
+     */
+    constexpr fixed_int operator-() const {
+        fixed_int result = *this;
+        result.negate();
+        if constexpr (Mode == overflow_mode::checked) {
+            if (Signed ? negative() && result.negative() : result != fixed_int()) overflow();
+        }
+        return result;
+    }
+
+    constexpr fixed_int& operator++() {
+        const bool was_negative = negative();
+        const limb_t carry = bigint_detail::add_1(limbs.data(), limbs.data(), limb_count, 1);
+        if constexpr (Mode == overflow_mode::checked) {
+            if (Signed ? !was_negative && negative() : carry != 0) overflow();
+        }
+        return *this;
+    }
+
+    constexpr fixed_int& operator--() {
+        const bool was_negative = negative();
+        const limb_t borrow = bigint_detail::sub_1(limbs.data(), limbs.data(), limb_count, 1);
+        if constexpr (Mode == overflow_mode::checked) {
+            if (Signed ? was_negative && !negative() : borrow != 0) overflow();
+        }
+        return *this;
+    }
+
+    constexpr fixed_int operator++(int) {
+        fixed_int temp = *this;
+        ++*this;
+        return temp;
+    }
+
+    constexpr fixed_int operator--(int) {
+        fixed_int temp = *this;
+        --*this;
+        return temp;
+    }
+
+    friend constexpr bool operator==(const fixed_int& lhs, const fixed_int& rhs) = default;
+
+    friend constexpr std::strong_ordering operator<=>(const fixed_int& lhs, const fixed_int& rhs) {
+        if (lhs.negative() != rhs.negative()) {
+            return lhs.negative() ? std::strong_ordering::less : std::strong_ordering::greater;
+        }
+        // Two's complement values of equal sign order like their unsigned limbs.
+        return bigint_detail::cmp(lhs.limbs.data(), limb_count, rhs.limbs.data(), limb_count) <=> 0;
+    }
+
+    friend std::ostream& operator<<(std::ostream& os, const fixed_int& value) {
+        return os << bigint(value);
+    }
+
+private:
+    std::array<limb_t, limb_count> limbs{};
+
+    [[nodiscard]] constexpr bool negative() const {
+        return Signed && (limbs[limb_count - 1] >> (bigint_detail::limb_bits - 1)) != 0;
+    }
+
+    [[nodiscard]] constexpr std::size_t significant_limbs() const {
+        std::size_t n = limb_count;
+        while (n > 0 && limbs[n - 1] == 0) --n;
+        return n;
+    }
+
+    /**
+     * @brief Replaces the limbs with their two's complement, 0 - value mod 2^Bits.
+     */
+    constexpr void negate() {
+        const std::array<limb_t, limb_count> zero{};
+        bigint_detail::sub_fixed<limb_count>(limbs.data(), zero.data(), limbs.data());
+    }
+
+    [[noreturn]] static void overflow() {
+        throw std::overflow_error("fixed_int overflow");
+    }
+};
+
+#endif
@@ -1,7 +1,59 @@
+#include <algorithm>
+#include <atomic>
 #include <cassert>
 
+// A small print buffer makes moderately long numbers exercise the split output path.
+#define BIGINT_STREAM_BUFFER_BYTES 4096
 #include "bigint.hpp"
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
 #include <iostream>
+#include <limits>
+#include <memory_resource>
+#include <mutex>
+#include <new>
+#include <sstream>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+// Counts every global allocation so tests can check that small values stay off the heap.
+// Every allocation and deallocation form is replaced, so that none of them mixes the
+// library's allocator with this one, and the functions are kept out of line so that the
+// compiler does not see free() applied to the result of operator new.
+static std::atomic<size_t> allocation_count = 0;
+
+[[gnu::noinline]] void* operator new(size_t size) {
+    ++allocation_count;
+    if (void* ptr = std::malloc(size == 0 ? 1 : size)) return ptr;
+    throw std::bad_alloc();
+}
+
+[[gnu::noinline]] void* operator new(size_t size, std::align_val_t alignment) {
+    ++allocation_count;
+    const auto align = static_cast<size_t>(alignment);
+    const size_t rounded = (std::max<size_t>(size, 1) + align - 1) / align * align;
+    if (void* ptr = std::aligned_alloc(align, rounded)) return ptr;
+    throw std::bad_alloc();
+}
+
+[[gnu::noinline]] void operator delete(void* ptr) noexcept {
+    std::free(ptr);
+}
+
+[[gnu::noinline]] void operator delete(void* ptr, size_t) noexcept {
+    std::free(ptr);
+}
+
+[[gnu::noinline]] void operator delete(void* ptr, std::align_val_t) noexcept {
+    std::free(ptr);
+}
+
+[[gnu::noinline]] void operator delete(void* ptr, size_t, std::align_val_t) noexcept {
+    std::free(ptr);
+}
 
 void test_bigint_constructors() {
     std::cout << "Running bigint constructor tests...\n";
@@ -929,6 +981,1332 @@ void test_bigint_decrement() {
     std::cout << "All bigint decrement tests passed successfully!\n";
 }
 
+void test_bigint_limb_boundaries() {
+    std::cout << "Running bigint limb boundary tests...\n";
+
+    // Test 1: Carry out of a full 64-bit limb
+    bigint a("18446744073709551615");
+    bigint result = a + bigint(1);
+    assert(result == bigint("18446744073709551616"));
+    std::cout << "Test 1 Passed: (2^64 - 1) + 1 = " << result << "\n";
+
+    // Test 2: Borrow across a limb boundary
+    a = bigint("18446744073709551616");
+    result = a - bigint(1);
+    assert(result == bigint("18446744073709551615"));
+    std::cout << "Test 2 Passed: 2^64 - 1 = " << result << "\n";
+
+    // Test 3: Product of two full limbs
+    a = bigint("18446744073709551615");
+    result = a * a;
+    assert(result == bigint("340282366920938463426481119284349108225"));
+    std::cout << "Test 3 Passed: (2^64 - 1)^2 = " << result << "\n";
+
+    // Test 4: Minimum int64_t value
+    a = bigint(INT64_MIN);
+    assert(a == bigint("-9223372036854775808"));
+    std::cout << "Test 4 Passed: bigint(INT64_MIN) = " << a << "\n";
+
+    // Test 5: Printing keeps the zero padding of inner decimal chunks
+    a = bigint("100000000000000000000000000000000000000001");
+    std::ostringstream out;
+    out << a;
+    assert(out.str() == "100000000000000000000000000000000000000001");
+    std::cout << "Test 5 Passed: round trip of " << a << "\n";
+
+    // Test 6: Comparison of negative numbers differing only in the lowest limb
+    assert(bigint("-36893488147419103233") < bigint("-36893488147419103232"));
+    assert(!(bigint(-5) < bigint(-5)));
+    std::cout << "Test 6 Passed: -36893488147419103233 < -36893488147419103232\n";
+
+    std::cout << "All bigint limb boundary tests passed successfully!\n";
+}
+
+void test_bigint_small_buffer() {
+    std::cout << "Running bigint small buffer tests...\n";
+
+    // Test 1: Construction, copies and moves of small values do not allocate
+    size_t before = allocation_count;
+    bigint a(123456789);
+    bigint b = a;
+    bigint c = std::move(b);
+    bigint d;
+    d = c;
+    assert(allocation_count == before);
+    std::cout << "Test 1 Passed: small construct/copy/move performed no allocation\n";
+
+    // Test 2: Arithmetic on one- and two-limb values does not allocate
+    before = allocation_count;
+    bigint result = a + c;
+    result = result - a;
+    result = a * c;
+    ++result;
+    result--;
+    assert(allocation_count == before);
+    assert(result == bigint(123456789) * bigint(123456789));
+    std::cout << "Test 2 Passed: small +, -, *, ++, -- performed no allocation\n";
+
+    // Test 3: Values beyond the inline capacity spill to the heap and stay correct
+    a = bigint("340282366920938463463374607431768211456");
+    b = a;
+    result = a * b;
+    assert(result == bigint("115792089237316195423570985008687907853269984665640564039457584007913129639936"));
+    std::cout << "Test 3 Passed: (2^128)^2 = " << result << "\n";
+
+    // Test 4: Moving a spilled value leaves a usable empty source
+    c = std::move(result);
+    result = bigint(7);
+    assert(result == bigint(7));
+    assert(c == a * a);
+    std::cout << "Test 4 Passed: moved-from bigint reassigned to " << result << "\n";
+
+    std::cout << "All bigint small buffer tests passed successfully!\n";
+}
+
+void test_bigint_multiplication_algorithms() {
+    std::cout << "Running bigint multiplication algorithm tests...\n";
+
+    const bigint_detail::tuning_parameters defaults = bigint::tuning();
+    const std::string nines(3000, '9');
+    const bigint a(nines);
+    const bigint expected(std::string(2999, '9') + "8" + std::string(2999, '0') + "1");
+
+    // Deterministic pseudo-random operands of unequal length, one of them negative
+    std::string x_digits, y_digits;
+    uint64_t state = 12345;
+    for (size_t i = 0; i < 2500; ++i) {
+        state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+        x_digits.push_back(static_cast<char>('0' + (state >> 60) % 10));
+        if (i < 1700) y_digits.push_back(static_cast<char>('0' + (state >> 56) % 10));
+    }
+    const bigint x(x_digits);
+    const bigint y("-" + y_digits);
+
+    bigint::tuning() = {1000000, 1000000, 1000000, 1000000};
+    const bigint schoolbook = x * y;
+
+    const struct {
+        const char* name;
+        bigint_detail::tuning_parameters tuning;
+    } cases[] = {
+        {"Karatsuba", {8, 1000000, 1000000, 1000000}},
+        {"Toom-3", {8, 16, 1000000, 1000000}},
+        {"Toom-4", {8, 16, 24, 1000000}},
+        {"NTT", {8, 16, 24, 64}},
+        {"default thresholds", defaults},
+    };
+
+    int test = 1;
+    for (const auto& algorithm : cases) {
+        bigint::tuning() = algorithm.tuning;
+        bigint result = a * a;
+        assert(result == expected);
+        std::cout << "Test " << test++ << " Passed: (10^3000 - 1)^2 with " << algorithm.name << "\n";
+
+        result = x * y;
+        assert(result == schoolbook);
+        std::cout << "Test " << test++ << " Passed: 2500-digit * -1700-digit with " << algorithm.name << "\n";
+    }
+
+    // Limbs of all ones give the largest possible convolution coefficients
+    bigint::tuning() = {8, 16, 24, 64};
+    const bigint ones("115792089237316195423570985008687907853269984665640564039457584007913129639935");
+    bigint power = ones;
+    for (int i = 0; i < 15; ++i) power = power * (ones + bigint(1)) + ones;
+    const bigint square = power * power;
+    bigint::tuning() = {1000000, 1000000, 1000000, 1000000};
+    assert(square == power * power);
+    std::cout << "Test " << test++ << " Passed: NTT square of 2^4096 - 1 matches schoolbook\n";
+    bigint::tuning() = defaults;
+
+    std::cout << "All bigint multiplication algorithm tests passed successfully!\n";
+}
+
+void test_bigint_parallel_multiplication() {
+    std::cout << "Running bigint parallel multiplication tests...\n";
+
+    const bigint_detail::tuning_parameters defaults = bigint::tuning();
+    std::string x_digits, y_digits;
+    uint64_t state = 987654321;
+    for (size_t i = 0; i < 6000; ++i) {
+        state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+        x_digits.push_back(static_cast<char>('0' + (state >> 60) % 10));
+        if (i < 2500) y_digits.push_back(static_cast<char>('0' + (state >> 56) % 10));
+    }
+    const bigint x(x_digits);
+    const bigint y(y_digits);
+
+    const struct {
+        const char* name;
+        bigint_detail::tuning_parameters tuning;
+    } cases[] = {
+        {"Karatsuba", {8, 1000000, 1000000, 1000000}},
+        {"Toom-4", {8, 16, 24, 1000000}},
+        {"NTT", {8, 16, 24, 64}},
+    };
+
+    int test = 1;
+    for (const auto& algorithm : cases) {
+        bigint::tuning() = algorithm.tuning;
+        const bigint serial_unbalanced = x * y;
+        const bigint serial_balanced = x * x;
+
+        bigint::set_parallelism(4, 8);
+        assert(bigint::parallelism().threads == 4);
+        const bigint parallel_unbalanced = x * y;
+        const bigint parallel_balanced = x * x;
+        bigint::set_parallelism(0);
+
+        assert(parallel_unbalanced == serial_unbalanced);
+        std::cout << "Test " << test++ << " Passed: parallel " << algorithm.name << " 6000-digit * 2500-digit\n";
+        assert(parallel_balanced == serial_balanced);
+        std::cout << "Test " << test++ << " Passed: parallel " << algorithm.name << " 6000-digit * 6000-digit\n";
+    }
+    bigint::tuning() = defaults;
+    assert(bigint::parallelism().threads == 0);
+
+    std::cout << "All bigint parallel multiplication tests passed successfully!\n";
+}
+
+void test_bigint_in_place_operators() {
+    std::cout << "Running bigint in-place operator tests...\n";
+
+    // Test 1: Accumulating into a bigint with spare capacity does not allocate
+    bigint sum("1000000000000000000000000000000000000000000000000000000000000");
+    const bigint term("123456789123456789123456789");
+    sum += term;
+    sum -= term;
+    size_t before = allocation_count;
+    for (int i = 0; i < 1000; ++i) sum += term;
+    for (int i = 0; i < 1000; ++i) sum -= term;
+    assert(allocation_count == before);
+    assert(sum == bigint("1000000000000000000000000000000000000000000000000000000000000"));
+    std::cout << "Test 1 Passed: 2000 in-place += / -= performed no allocation\n";
+
+    // Test 2: Increment and decrement across limb boundaries without allocation
+    bigint a("18446744073709551615");
+    before = allocation_count;
+    ++a;
+    --a;
+    --a;
+    assert(allocation_count == before);
+    assert(a == bigint("18446744073709551614"));
+    std::cout << "Test 2 Passed: ++/-- around 2^64 = " << a << "\n";
+
+    // Test 3: Sign changes during in-place subtraction
+    a = bigint(5);
+    a -= bigint(12);
+    assert(a == bigint(-7));
+    a += bigint(7);
+    assert(a == bigint(0));
+    --a;
+    assert(a == bigint(-1));
+    ++a;
+    assert(a == bigint(0));
+    std::cout << "Test 3 Passed: 5 - 12 + 7 - 1 + 1 = " << a << "\n";
+
+    // Test 4: Self-assignment forms
+    a = bigint("-123456789012345678901234567890");
+    a += a;
+    assert(a == bigint("-246913578024691357802469135780"));
+    a -= a;
+    assert(a == bigint(0));
+    std::cout << "Test 4 Passed: a += a and a -= a\n";
+
+    // Test 5: Operators taking expiring operands
+    const bigint b("99999999999999999999999999");
+    assert(bigint(1) + b == bigint("100000000000000000000000000"));
+    assert(b + bigint(1) == bigint("100000000000000000000000000"));
+    assert(bigint(1) - b == bigint("-99999999999999999999999998"));
+    assert(b - bigint(1) == bigint("99999999999999999999999998"));
+    assert(bigint(1) - bigint(3) == bigint(-2));
+    assert(-(b - bigint(1)) == bigint("-99999999999999999999999998"));
+    std::cout << "Test 5 Passed: rvalue +, - and unary - overloads\n";
+
+    std::cout << "All bigint in-place operator tests passed successfully!\n";
+}
+
+void test_bigint_expression_templates() {
+    std::cout << "Running bigint expression template tests...\n";
+
+    const bigint a("123456789012345678901234567890");
+    const bigint b("-987654321098765432109876543210");
+    const bigint c("55555555555555555555555555555555555555");
+
+    // Test 1: Products fused with a following addition or subtraction
+    bigint r = a * b + c;
+    assert(r == bigint("-121932631137021795226129477178067367776681908245555707971345"));
+    r = c - a * b;
+    assert(r == bigint("121932631137021795226240588289178478887793019356666819082455"));
+    r = a * b - c;
+    assert(r == -(c - a * b));
+    std::cout << "Test 1 Passed: a * b + c = " << a * b + c << "\n";
+
+    // Test 2: The destination appearing inside the expression
+    bigint x = a;
+    x = x * b + x;
+    assert(x == a * b + a);
+    x = a;
+    x -= x * b;
+    assert(x == a - a * b);
+    std::cout << "Test 2 Passed: x = x * b + x and x -= x * b\n";
+
+    // Test 3: Nested expressions and compound assignment
+    bigint sum = c;
+    sum += a * b;
+    sum -= (a + b) * (a - b);
+    bigint expected = a * b;
+    expected += c;
+    expected -= a * a;
+    expected += b * b;
+    assert(sum == expected);
+    std::cout << "Test 3 Passed: c + a * b - (a + b) * (a - b) = " << sum << "\n";
+
+    // Test 4: Expressions compare and print like bigints
+    assert(a * b < c);
+    assert(a + b == b + a);
+    assert(a * b + bigint(1) == bigint(1) + a * b);
+    assert(a * b - bigint(1) == -(bigint(1) - a * b));
+    std::ostringstream stream;
+    stream << a - a;
+    assert(stream.str() == "0");
+    std::cout << "Test 4 Passed: expressions compare and print directly\n";
+
+    // Test 5: Evaluating a small expression into an existing bigint does not allocate
+    const bigint p(1000003), q(-999983), s(77);
+    bigint out("340282366920938463463374607431768211456");
+    size_t before = allocation_count;
+    for (int i = 0; i < 1000; ++i) out = p * q + s;
+    assert(allocation_count == before);
+    assert(out == bigint(-999985999872));
+    std::cout << "Test 5 Passed: out = p * q + s performed no allocation\n";
+
+    std::cout << "All bigint expression template tests passed successfully!\n";
+}
+
+void test_bigint_division() {
+    std::cout << "Running bigint division tests...\n";
+
+    // Test 1: Truncation towards zero for every sign combination
+    assert(bigint(7) / bigint(2) == bigint(3) && bigint(7) % bigint(2) == bigint(1));
+    assert(bigint(-7) / bigint(2) == bigint(-3) && bigint(-7) % bigint(2) == bigint(-1));
+    assert(bigint(7) / bigint(-2) == bigint(-3) && bigint(7) % bigint(-2) == bigint(1));
+    assert(bigint(-7) / bigint(-2) == bigint(3) && bigint(-7) % bigint(-2) == bigint(-1));
+    assert(bigint(5) / bigint(9) == bigint(0) && bigint(-5) % bigint(9) == bigint(-5));
+    std::cout << "Test 1 Passed: -7 / 2 = " << bigint(-7) / bigint(2) << ", -7 % 2 = " << bigint(-7) % bigint(2) << "\n";
+
+    // Test 2: Division by zero throws
+    bool thrown = false;
+    try {
+        bigint(1) / bigint(0);
+    } catch (const std::domain_error&) {
+        thrown = true;
+    }
+    assert(thrown);
+    std::cout << "Test 2 Passed: division by zero throws std::domain_error\n";
+
+    // Test 3: Single and multi-limb divisors
+    const bigint n("340282366920938463463374607431768211455");
+    assert(n / bigint("18446744073709551616") == bigint("18446744073709551615"));
+    assert(n % bigint("18446744073709551616") == bigint("18446744073709551615"));
+    assert(n / bigint(1000000007) == bigint("340282364538961911690641225597"));
+    assert(n % bigint(1000000007) == bigint(279632276));
+    const bigint d("123456789012345678901234567890123456789");
+    const bigint q("987654321098765432109876543210987654321098765432109876543210");
+    assert((q * d + bigint(12345)) / d == q);
+    assert((q * d + bigint(12345)) % d == bigint(12345));
+    std::cout << "Test 3 Passed: (2^128 - 1) / 1000000007 = " << n / bigint(1000000007) << "\n";
+
+    // Test 4: Quotient digit estimates that need correcting
+    const bigint b64("18446744073709551616");
+    const bigint divisor = b64 * b64 - b64 - bigint(1);
+    const bigint dividend = b64 * b64 * b64 * b64 - bigint(1);
+    auto [quot, rem] = divmod(dividend, divisor);
+    assert(quot == bigint("340282366920938463481821351505477763074"));
+    assert(rem == bigint("55340232221128654849"));
+    std::cout << "Test 4 Passed: (2^256 - 1) divmod (2^128 - 2^64 - 1)\n";
+
+    // Test 5: Burnikel-Ziegler division agrees with algorithm D
+    bigint big_divisor("1");
+    for (int i = 0; i < 12; ++i) big_divisor *= bigint("98765432109876543210987654321");
+    bigint big_dividend = big_divisor * big_divisor * bigint("1234567890123456789") + bigint("42");
+    const bigint_detail::tuning_parameters saved = bigint::tuning();
+    bigint::tuning().div_burnikel_ziegler = 1000000;
+    auto [q_basecase, r_basecase] = divmod(big_dividend, big_divisor);
+    bigint::tuning().div_burnikel_ziegler = 4;
+    auto [q_recursive, r_recursive] = divmod(big_dividend, big_divisor);
+    bigint::tuning() = saved;
+    assert(q_basecase == q_recursive && r_basecase == r_recursive);
+    assert(q_recursive == big_divisor * bigint("1234567890123456789") && r_recursive == bigint(42));
+    std::cout << "Test 5 Passed: recursive and schoolbook division agree on a 12-factor divisor\n";
+
+    // Test 6: Compound assignment, including the divisor being the object itself
+    bigint a("100000000000000000000000000000");
+    a /= bigint("1000000000000000");
+    assert(a == bigint("100000000000000"));
+    a %= bigint(7);
+    assert(a == bigint("100000000000000") % bigint(7));
+    bigint self("-123456789123456789123456789");
+    bigint copy = self;
+    self /= self;
+    copy %= copy;
+    assert(self == bigint(1) && copy == bigint(0));
+    std::cout << "Test 6 Passed: /=, %= and self-division\n";
+
+    std::cout << "All bigint division tests passed successfully!\n";
+}
+
+void test_bigint_decimal_conversion() {
+    std::cout << "Running bigint decimal conversion tests...\n";
+
+    // Test 1: Powers of ten survive a round trip through parsing and printing
+    const std::string power = "1" + std::string(5000, '0');
+    bigint ten_to_5000(power);
+    bigint expected(1);
+    for (int i = 0; i < 5000; ++i) expected *= bigint(10);
+    assert(ten_to_5000 == expected);
+    std::ostringstream printed;
+    printed << ten_to_5000;
+    assert(printed.str() == power);
+    std::cout << "Test 1 Passed: 10^5000 parsed and printed\n";
+
+    // Test 2: Long runs of zero digits inside the low halves keep their padding
+    const std::string sparse = "-7" + std::string(3000, '0') + "1" + std::string(1500, '0') + "42";
+    std::ostringstream sparse_out;
+    sparse_out << bigint(sparse);
+    assert(sparse_out.str() == sparse);
+    std::cout << "Test 2 Passed: zero runs and sign preserved over " << sparse.size() << " characters\n";
+
+    // Test 3: Divide-and-conquer and chunked conversion agree
+    std::string digits;
+    for (int i = 0; i < 20000; ++i) digits += static_cast<char>('0' + (i * 7 + i / 13) % 10);
+    const bigint_detail::tuning_parameters saved = bigint::tuning();
+    bigint::tuning().str_divide_conquer = 1000000;
+    const bigint chunked(digits);
+    std::ostringstream chunked_out;
+    chunked_out << chunked;
+    bigint::tuning().str_divide_conquer = 2;
+    const bigint recursive(digits);
+    std::ostringstream recursive_out;
+    recursive_out << recursive;
+    bigint::tuning() = saved;
+    assert(chunked == recursive);
+    assert(chunked_out.str() == recursive_out.str());
+    assert(chunked_out.str() == digits.substr(digits.find_first_not_of('0')));
+    std::cout << "Test 3 Passed: both conversions agree on a 20000-digit number\n";
+
+    // Test 4: Leading zeros and negative zero
+    assert(bigint(std::string(100, '0') + "123") == bigint(123));
+    std::ostringstream zero_out;
+    zero_out << bigint("-" + std::string(1000, '0'));
+    assert(zero_out.str() == "0");
+    std::cout << "Test 4 Passed: leading zeros are dropped and -0 prints as 0\n";
+
+    std::cout << "All bigint decimal conversion tests passed successfully!\n";
+}
+
+void test_bigint_char_conversion() {
+    std::cout << "Running bigint to_chars/from_chars tests...\n";
+
+    // Test 1: from_chars stops at the first character that is not a digit
+    const std::string_view line = "-98765432109876543210987654321,42";
+    bigint value;
+    std::from_chars_result parsed = from_chars(line.data(), line.data() + line.size(), value);
+    assert(parsed.ec == std::errc{});
+    assert(parsed.ptr == line.data() + line.find(','));
+    assert(value == bigint("-98765432109876543210987654321"));
+    parsed = from_chars(parsed.ptr + 1, line.data() + line.size(), value);
+    assert(parsed.ec == std::errc{} && parsed.ptr == line.data() + line.size() && value == bigint(42));
+    std::cout << "Test 1 Passed: parsed two fields of \"" << line << "\"\n";
+
+    // Test 2: Invalid input is reported without throwing and leaves the value unchanged
+    for (std::string_view bad : {"", "-", "+5", "x1", "-x"}) {
+        parsed = from_chars(bad.data(), bad.data() + bad.size(), value);
+        assert(parsed.ec == std::errc::invalid_argument && parsed.ptr == bad.data());
+        assert(value == bigint(42));
+    }
+    std::cout << "Test 2 Passed: invalid input reported as std::errc::invalid_argument\n";
+
+    // Test 3: to_chars into exact, oversized and undersized buffers
+    const bigint number("-18446744073709551616");
+    char buffer[32];
+    std::to_chars_result written = to_chars(buffer, buffer + sizeof(buffer), number);
+    assert(written.ec == std::errc{});
+    assert(std::string_view(buffer, written.ptr) == "-18446744073709551616");
+    written = to_chars(buffer, buffer + 21, number);
+    assert(written.ec == std::errc{} && written.ptr == buffer + 21);
+    written = to_chars(buffer, buffer + 20, number);
+    assert(written.ec == std::errc::value_too_large && written.ptr == buffer + 20);
+    written = to_chars(buffer, buffer + 1, bigint(0));
+    assert(written.ec == std::errc{} && buffer[0] == '0');
+    std::cout << "Test 3 Passed: to_chars writes " << std::string_view(buffer, 1) << " and reports short buffers\n";
+
+    // Test 4: decimal_size is an upper bound at most one above the exact length
+    bigint power(1);
+    for (int i = 0; i < 300; ++i) {
+        const bigint signed_power = i % 2 ? -power : power;
+        std::ostringstream text;
+        text << signed_power;
+        assert(signed_power.decimal_size() >= text.str().size());
+        assert(signed_power.decimal_size() <= text.str().size() + 1);
+        power *= bigint(7);
+    }
+    std::cout << "Test 4 Passed: decimal_size bounds 7^i for i < 300\n";
+
+    // Test 5: Round trips of short numbers through a fixed buffer do not allocate
+    char field[64];
+    bigint parsed_value(std::string_view("123456789012345678901234567890"));
+    size_t before = allocation_count;
+    for (int64_t i = 1; i < 1000; ++i) {
+        written = to_chars(field, field + sizeof(field), bigint(i * 1000003));
+        parsed = from_chars(field, written.ptr, parsed_value);
+        assert(parsed.ec == std::errc{});
+    }
+    assert(allocation_count == before);
+    assert(parsed_value == bigint(999 * 1000003));
+    std::cout << "Test 5 Passed: 999 to_chars/from_chars round trips performed no allocation\n";
+
+    // Test 6: The string_view constructor parses part of a larger buffer without copying
+    const char record[] = "id=31415926535897932384626433832795;";
+    assert(bigint(std::string_view(record + 3, 32)) == bigint("31415926535897932384626433832795"));
+    bool thrown = false;
+    try {
+        bigint minus_only("-");
+    } catch (const std::invalid_argument&) {
+        thrown = true;
+    }
+    assert(thrown);
+    std::cout << "Test 6 Passed: string_view constructor and rejection of \"-\"\n";
+
+    std::cout << "All bigint to_chars/from_chars tests passed successfully!\n";
+}
+
+void test_bigint_powmod() {
+    std::cout << "Running bigint powmod tests...\n";
+
+    // Test 1: Small values and signs
+    assert(bigint::powmod(bigint(4), bigint(13), bigint(497)) == bigint(445));
+    assert(bigint::powmod(bigint(-2), bigint(3), bigint(5)) == bigint(2));
+    assert(bigint::powmod(bigint(2), bigint(3), bigint(-5)) == bigint(3));
+    assert(bigint::powmod(bigint(-7), bigint(5), bigint(12)) == bigint(5));
+    assert(bigint::powmod(bigint(123), bigint(0), bigint(10)) == bigint(1));
+    assert(bigint::powmod(bigint(123), bigint(45), bigint(1)) == bigint(0));
+    std::cout << "Test 1 Passed: 4^13 mod 497 = " << bigint::powmod(bigint(4), bigint(13), bigint(497)) << "\n";
+
+    // Test 2: Fermat's little theorem for Mersenne primes, in Montgomery form
+    for (int exponent : {127, 521, 1279, 2203}) {
+        bigint p(1);
+        for (int i = 0; i < exponent; ++i) p *= bigint(2);
+        --p;
+        assert(bigint::powmod(bigint(3), p - bigint(1), p) == bigint(1));
+        assert(bigint::powmod(bigint(-5), p, p) == p - bigint(5));
+    }
+    std::cout << "Test 2 Passed: 3^(p - 1) mod p = 1 for p = 2^127 - 1 ... 2^2203 - 1\n";
+
+    // Test 3: Montgomery form and reduction by division agree
+    bigint modulus("1");
+    for (int i = 0; i < 40; ++i) modulus *= bigint("1000000000000000003");
+    const bigint base("31415926535897932384626433832795028841971693993751");
+    const bigint exponent = modulus - bigint(2);
+    const bigint_detail::tuning_parameters saved = bigint::tuning();
+    const bigint montgomery = bigint::powmod(base, exponent, modulus);
+    bigint::tuning().powmod_division = 1;
+    const bigint division = bigint::powmod(base, exponent, modulus);
+    bigint::tuning() = saved;
+    assert(montgomery == division);
+    std::cout << "Test 3 Passed: both reductions agree for (10^18 + 3)^40\n";
+
+    // Test 4: Even modulus matches repeated multiplication
+    bigint even(1);
+    for (int i = 0; i < 100; ++i) even *= bigint(2);
+    bigint expected(1);
+    for (int i = 0; i < 1000; ++i) expected = expected * bigint(3) % even;
+    assert(bigint::powmod(bigint(3), bigint(1000), even) == expected);
+    std::cout << "Test 4 Passed: 3^1000 mod 2^100 = " << expected << "\n";
+
+    // Test 5: Invalid arguments throw
+    int thrown = 0;
+    try {
+        bigint::powmod(bigint(2), bigint(3), bigint(0));
+    } catch (const std::domain_error&) {
+        ++thrown;
+    }
+    try {
+        bigint::powmod(bigint(2), bigint(-3), bigint(7));
+    } catch (const std::domain_error&) {
+        ++thrown;
+    }
+    assert(thrown == 2);
+    std::cout << "Test 5 Passed: zero modulus and negative exponent throw std::domain_error\n";
+
+    std::cout << "All bigint powmod tests passed successfully!\n";
+}
+
+void test_bigint_squaring() {
+    std::cout << "Running bigint squaring tests...\n";
+
+    // Test 1: Squares match full products of a copy at every tier
+    const bigint_detail::tuning_parameters saved = bigint::tuning();
+    bigint::tuning() = {4, 8, 12, 16};
+    bigint::tuning().sqr_karatsuba = 4;
+    bigint x("1");
+    for (int i = 0; i < 60; ++i) {
+        x = x * bigint("98765432109876543210987654321") + bigint(i);
+        const bigint copy = x;
+        assert(square(x) == x * copy);
+        assert(x * x == x * copy);
+        bigint y = x;
+        y *= y;
+        assert(y == x * copy);
+        assert(square(-x) == x * copy);
+    }
+    bigint::tuning() = saved;
+    std::cout << "Test 1 Passed: square(x), x * x and x *= x match x * copy up to "
+              << x.decimal_size() << " digits\n";
+
+    // Test 2: Squaring kernel on its own up to the Karatsuba crossover
+    bigint z("18446744073709551615");
+    for (int i = 0; i < 7; ++i) {
+        const bigint copy = z;
+        assert(square(z) == z * copy);
+        z = square(z) - bigint(1);
+    }
+    assert(square(bigint(0)) == bigint(0));
+    assert(square(bigint(-12345)) == bigint(152399025));
+    std::cout << "Test 2 Passed: square(-12345) = " << square(bigint(-12345)) << "\n";
+
+    // Test 3: Integer powers
+    assert(pow(bigint(2), 100) == bigint("1267650600228229401496703205376"));
+    assert(pow(bigint(-3), 5) == bigint(-243));
+    assert(pow(bigint(-3), 4) == bigint(81));
+    assert(pow(bigint(12345), 0) == bigint(1));
+    assert(pow(bigint(0), 0) == bigint(1));
+    assert(pow(bigint(0), 7) == bigint(0));
+    bigint product(1);
+    const bigint base("123456789123456789");
+    for (int i = 0; i < 77; ++i) product *= base;
+    assert(pow(base, 77) == product);
+    std::cout << "Test 3 Passed: 2^100 = " << pow(bigint(2), 100) << "\n";
+
+    std::cout << "All bigint squaring tests passed successfully!\n";
+}
+
+void test_bigint_simd_kernels() {
+    std::cout << "Running bigint SIMD kernel tests...\n";
+
+    // Test 1: Every supported kernel level matches the portable loops, carries and borrows
+    // rippling across whole vector registers included
+    using bigint_detail::limb_t;
+    const limb_t ones = ~limb_t{0};
+    const bigint_detail::kernel_table generic = bigint_detail::select_kernels(bigint_detail::cpu_level::generic);
+    const bigint_detail::cpu_level detected = bigint_detail::detect_cpu_level();
+    int levels = 0;
+    for (bigint_detail::cpu_level level : {bigint_detail::cpu_level::avx2, bigint_detail::cpu_level::avx512}) {
+        if (level > detected) continue;
+        const bigint_detail::kernel_table kernels = bigint_detail::select_kernels(level);
+        ++levels;
+        limb_t seed = 0x9e3779b97f4a7c15ULL;
+        for (std::size_t n = 0; n < 40; ++n) {
+            std::vector<limb_t> a(n), b(n), expected(n), actual(n);
+            for (std::size_t i = 0; i < n; ++i) {
+                seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+                a[i] = seed % 3 == 0 ? ones : seed;
+                b[i] = seed % 5 == 0 ? limb_t{1} : seed % 5 == 1 ? limb_t{0} : seed >> 7;
+            }
+            assert(kernels.add_n(actual.data(), a.data(), b.data(), n) == generic.add_n(expected.data(), a.data(), b.data(), n));
+            assert(actual == expected);
+            assert(kernels.sub_n(actual.data(), b.data(), a.data(), n) == generic.sub_n(expected.data(), b.data(), a.data(), n));
+            assert(actual == expected);
+            assert(kernels.cmp_n(a.data(), b.data(), n) == generic.cmp_n(a.data(), b.data(), n));
+            assert(kernels.cmp_n(a.data(), a.data(), n) == 0);
+            if (n > 0) {
+                b = a;
+                b[n / 3] ^= 1;
+                assert(kernels.cmp_n(a.data(), b.data(), n) == generic.cmp_n(a.data(), b.data(), n));
+            }
+        }
+    }
+    std::cout << "Test 1 Passed: " << levels << " vector kernel level(s) match the portable kernels\n";
+
+    // Test 2: Long carry chains through bigint arithmetic, with the detected and the portable kernels
+    const bigint_detail::kernel_table saved = bigint_detail::kernels;
+    for (const bigint_detail::kernel_table& kernels : {saved, generic}) {
+        bigint_detail::kernels = kernels;
+        bigint power(1);
+        for (int i = 0; i < 64 * 37; ++i) power += power;
+        const bigint all_ones = power - bigint(1);
+        assert(all_ones + bigint(1) == power);
+        assert(power - all_ones == bigint(1));
+        assert(all_ones < power);
+        assert(all_ones + all_ones == power + power - bigint(2));
+        assert((power + all_ones) - (all_ones + bigint(1)) == all_ones);
+    }
+    bigint_detail::kernels = saved;
+    std::cout << "Test 2 Passed: (2^2368 - 1) + 1 = 2^2368 with each kernel table\n";
+
+    // Test 3: Multiply-accumulate kernels match the portable loops, with all-ones limbs to
+    // push both carry chains to their limits
+    const bool mulx_adx = bigint_detail::detect_mulx_adx();
+    if (mulx_adx) {
+        const bigint_detail::kernel_table kernels = bigint_detail::select_kernels(bigint_detail::cpu_level::generic, true);
+        limb_t seed = 0x2545f4914f6cdd1dULL;
+        for (std::size_t n = 0; n < 40; ++n) {
+            for (limb_t factor : {limb_t{0}, limb_t{1}, ones, limb_t{0x123456789abcdefULL}}) {
+                std::vector<limb_t> a(n), r(n);
+                for (std::size_t i = 0; i < n; ++i) {
+                    seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+                    a[i] = seed % 3 == 0 ? ones : seed;
+                    r[i] = seed % 4 == 0 ? ones : seed % 4 == 1 ? limb_t{0} : seed >> 3;
+                }
+                std::vector<limb_t> expected = r, actual = r;
+                assert(kernels.mul_1(actual.data(), a.data(), n, factor) == generic.mul_1(expected.data(), a.data(), n, factor));
+                assert(actual == expected);
+                actual = expected = r;
+                assert(kernels.addmul_1(actual.data(), a.data(), n, factor) == generic.addmul_1(expected.data(), a.data(), n, factor));
+                assert(actual == expected);
+                actual = expected = r;
+                assert(kernels.submul_1(actual.data(), a.data(), n, factor) == generic.submul_1(expected.data(), a.data(), n, factor));
+                assert(actual == expected);
+            }
+        }
+    }
+    std::cout << "Test 3 Passed: MULX/ADX kernels " << (mulx_adx ? "match the portable kernels" : "not supported, skipped") << "\n";
+
+    std::cout << "All bigint SIMD kernel tests passed successfully!\n";
+}
+
+void test_bigint_memory_resource() {
+    std::cout << "Running bigint memory resource tests...\n";
+
+    // Test 1: A computation runs entirely out of a monotonic buffer, temporaries and the
+    // scratch space of every multiplication and division algorithm included
+    static std::byte buffer[1 << 22];
+    std::pmr::monotonic_buffer_resource pool(buffer, sizeof(buffer), std::pmr::null_memory_resource());
+    const bigint_detail::tuning_parameters saved = bigint::tuning();
+    bigint::tuning() = {4, 8, 12, 64, 4};
+    bigint kept;
+    size_t before = allocation_count;
+    {
+        const bigint::memory_scope scope(&pool);
+        bigint x("123456789012345678901234567890123456789");
+        for (int i = 0; i < 6; ++i) x = x * x + bigint(i);
+        const bigint y = x / (x - bigint("987654321987654321987654321")) + x % bigint("1000000007");
+        assert(x.get_allocator().resource() == &pool);
+        assert(y.get_allocator().resource() == &pool);
+        assert(divmod(x, y).first * y + divmod(x, y).second == x);
+        kept = x + y;
+        assert(kept.get_allocator().resource() != &pool);
+    }
+    assert(allocation_count == before + 1);
+    bigint::tuning() = saved;
+    std::cout << "Test 1 Passed: multiply, divide and divmod chains allocated only from the pool\n";
+
+    // Test 2: Moving a value out of the scope copies it onto the heap of its destination
+    {
+        bigint escaped;
+        {
+            const bigint::memory_scope scope(&pool);
+            bigint inner("340282366920938463463374607431768211457");
+            escaped = std::move(inner);
+        }
+        pool.release();
+        assert(escaped.get_allocator().resource() == std::pmr::new_delete_resource());
+        assert(escaped == bigint("340282366920938463463374607431768211457"));
+    }
+    std::cout << "Test 2 Passed: values assigned out of the scope survive releasing the pool\n";
+
+    // Test 3: std::pmr containers place their bigint elements in their own resource
+    {
+        std::pmr::monotonic_buffer_resource arena;
+        std::pmr::vector<bigint> values(&arena);
+        values.emplace_back("1000000000000000000000000000000");
+        values.emplace_back(values.back());
+        values.push_back(values[0] * values[1]);
+        values.emplace_back();
+        for (const bigint& value : values) {
+            assert(value.get_allocator().resource() == &arena);
+        }
+        assert(values[2] == bigint("1000000000000000000000000000000000000000000000000000000000000"));
+        const bigint copied(std::allocator_arg, &arena, kept);
+        assert(copied == kept && copied.get_allocator().resource() == &arena);
+    }
+    std::cout << "Test 3 Passed: std::pmr::vector<bigint> elements allocate from the vector's resource\n";
+
+    // Test 4: Parallel tasks run in the scope of the thread that submitted them, so the
+    // products and temporaries of the worker threads come from the scoped resource too
+    {
+        class locked_resource : public std::pmr::memory_resource {
+        public:
+            locked_resource(void* buffer, size_t size) : arena(buffer, size, std::pmr::null_memory_resource()) {}
+
+        private:
+            void* do_allocate(size_t bytes, size_t alignment) override {
+                const std::lock_guard<std::mutex> lock(mutex);
+                return arena.allocate(bytes, alignment);
+            }
+            void do_deallocate(void* ptr, size_t bytes, size_t alignment) override {
+                const std::lock_guard<std::mutex> lock(mutex);
+                arena.deallocate(ptr, bytes, alignment);
+            }
+            bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+
+            std::mutex mutex;
+            std::pmr::monotonic_buffer_resource arena;
+        };
+
+        static std::byte shared_buffer[1 << 22];
+        locked_resource shared(shared_buffer, sizeof(shared_buffer));
+        const bigint x = pow(bigint(7), 20000) + 1;
+        const bigint y = pow(bigint(3), 30000) - 1;
+        const bigint serial = x * y;
+        bigint::tuning() = {8, 16, 24, 1000000};
+        bigint::set_parallelism(4, 8);
+        {
+            const bigint::memory_scope scope(&shared);
+            std::pmr::memory_resource* seen[64] = {};
+            bigint_detail::task_group group(true);
+            for (auto& resource : seen) {
+                group.run([&resource] {
+                    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                    resource = bigint_detail::scoped_resource;
+                });
+            }
+            group.wait();
+            for (const auto* resource : seen) assert(resource == &shared);
+            const bigint product = x * y;
+            assert(product == serial);
+            assert(product.get_allocator().resource() == &shared);
+        }
+        bigint::set_parallelism(0);
+        bigint::tuning() = saved;
+    }
+    std::cout << "Test 4 Passed: parallel tasks and Toom-4 products use the scope of the submitting thread\n";
+
+    std::cout << "All bigint memory resource tests passed successfully!\n";
+}
+
+void test_bigint_native_integers() {
+    std::cout << "Running bigint native integer tests...\n";
+
+    // Test 1: Arithmetic with built-in integers on either side
+    const bigint a("123456789012345678901234567890");
+    assert(a + 10 == bigint("123456789012345678901234567900"));
+    assert(10 + a == a + 10);
+    assert(a - 90 == bigint("123456789012345678901234567800"));
+    assert(90 - a == -(a - 90));
+    assert(a * -3 == bigint("-370370367037037036703703703670"));
+    assert(3u * a == bigint("370370367037037036703703703670"));
+    assert(a / 1000 == bigint("123456789012345678901234567"));
+    assert(a % 1000 == 890);
+    assert(bigint(3) - 5 == -2 && bigint(-3) + 5 == 2 && bigint(5) - 5 == 0);
+    assert(bigint(-7) / 2 == -3 && bigint(-7) % 2 == -1 && bigint(7) % -2 == 1);
+    assert(-7 / bigint(2) == -3 && 7 % bigint(-2) == 1 && 5 / a == 0 && 5 % a == 5);
+    std::cout << "Test 1 Passed: a * -3 = " << a * -3 << "\n";
+
+    // Test 2: The full ranges of int64_t and uint64_t
+    const uint64_t max_u = std::numeric_limits<uint64_t>::max();
+    const int64_t min_i = std::numeric_limits<int64_t>::min();
+    assert(bigint(max_u) == bigint("18446744073709551615"));
+    assert(bigint(min_i) == bigint("-9223372036854775808"));
+    assert(bigint(0) - min_i == bigint("9223372036854775808"));
+    assert(bigint(max_u) + max_u == bigint("36893488147419103230"));
+    assert(bigint(max_u) * max_u == bigint("340282366920938463426481119284349108225"));
+    assert(bigint(min_i) / -1 == bigint("9223372036854775808"));
+    std::cout << "Test 2 Passed: uint64_t max squared = " << bigint(max_u) * max_u << "\n";
+
+    // Test 3: Comparisons in both directions
+    assert(a > 5 && 5 < a && a != 5 && -a < -5 && a > max_u);
+    assert(bigint(-1) < 0 && 0 > bigint(-1) && bigint(0) == 0 && bigint(0) == 0u);
+    assert(bigint(42) == 42 && 42 == bigint(42) && bigint(42) <= 42 && bigint(42) >= 42);
+    assert(bigint(-42) != 42 && (bigint(-42) <=> -41) == std::strong_ordering::less);
+    assert((a <=> bigint(7)) == std::strong_ordering::greater && (bigint(7) <=> bigint(7)) == 0);
+    std::cout << "Test 3 Passed: mixed comparisons and <=> agree with the values\n";
+
+    // Test 4: In-place updates and carries that stop early, without allocation
+    bigint counter;
+    bigint boundary("340282366920938463463374607431768211455");  // 2^128 - 1
+    bigint big("1000000000000000000000000000000000000000000000000000000000000");
+    size_t before = allocation_count;
+    for (int i = 0; i < 1000; ++i) {
+        counter += 7;
+        counter *= -3;
+        counter -= 5;
+        counter /= 2;
+        counter %= 1000;
+        big += i;
+        big -= i;
+    }
+    assert(allocation_count == before);
+    assert(counter == 30);
+    boundary += 1;
+    assert(boundary == bigint("340282366920938463463374607431768211456"));
+    boundary -= 1;
+    assert(boundary == bigint("340282366920938463463374607431768211455"));
+    boundary %= 1000000007;
+    assert(boundary == 279632276);
+    std::cout << "Test 4 Passed: 7000 in-place operations with integers performed no allocation\n";
+
+    // Test 5: Division by a zero integer throws
+    int thrown = 0;
+    try {
+        (void)(a / 0);
+    } catch (const std::domain_error&) {
+        ++thrown;
+    }
+    try {
+        bigint b(5);
+        b %= 0u;
+    } catch (const std::domain_error&) {
+        ++thrown;
+    }
+    assert(thrown == 2);
+    std::cout << "Test 5 Passed: division by a zero integer throws std::domain_error\n";
+
+    std::cout << "All bigint native integer tests passed successfully!\n";
+}
+
+void test_bigint_constexpr() {
+    std::cout << "Running bigint constexpr tests...\n";
+
+    // Test 1: Construction, comparison and + - * in constant expressions
+    static_assert(bigint(5) + bigint(7) == 12);
+    static_assert(bigint(5) - bigint(7) < 0 && -bigint(5) == -5);
+    static_assert(bigint("123456789012345678901234567890") * bigint("123456789012345678901234567890") -
+                      bigint("123456789012345678901234567890") ==
+                  bigint("15241578753238836750495351562412741998489559520973784484210"));
+    static_assert((bigint("-18446744073709551616") <=> bigint(-1)) == std::strong_ordering::less);
+    static_assert([] {
+        bigint x(1);
+        for (int i = 0; i < 100; ++i) x *= 2;
+        x += 7;
+        ++x;
+        --x;
+        return x - 7 == bigint("1267650600228229401496703205376");
+    }());
+    std::cout << "Test 1 Passed: 2^100 built in a constant expression\n";
+
+    // Test 2: The _big literal in every base
+    static_assert(123456789012345678901234567890_big == bigint("123456789012345678901234567890"));
+    static_assert(0x1'0000'0000'0000'0000_big == bigint("18446744073709551616"));
+    static_assert(0b1011_big == 11 && 0777_big == 511 && 0_big == 0 && -42_big == -42);
+    static_assert(pow(3_big, 100) == 515377520732011331036461129765621272702107522001_big);
+    static_assert(-(123456789012345678901234567890_big * 123456789012345678901234567890_big) * 3 + 1 ==
+                  -45724736259716510251486054687608596362505715599625057156299_big);
+    std::cout << "Test 2 Passed: decimal, hexadecimal, binary and octal literals\n";
+
+    // Test 3: Values that fit inline can be constexpr variables
+    constexpr bigint limit = 0xffff'ffff'ffff'ffff'ffff'ffff'ffff'ffff_big;
+    static_assert(limit + 1 == bigint("340282366920938463463374607431768211456"));
+    bigint runtime = 340282366920938463463374607431768211456_big;
+    assert(runtime == limit + 1);
+    std::ostringstream out;
+    out << runtime;
+    assert(out.str() == "340282366920938463463374607431768211456");
+    std::cout << "Test 3 Passed: constexpr limit = " << limit << "\n";
+
+    std::cout << "All bigint constexpr tests passed successfully!\n";
+}
+
+void test_bigint_fixed_int() {
+    std::cout << "Running fixed_int tests...\n";
+
+    // Test 1: Wrapping arithmetic modulo 2^Bits, with no heap and no padding
+    using u256 = fixed_int<256>;
+    static_assert(sizeof(u256) == 32 && std::is_trivially_copyable_v<u256>);
+    static_assert(u256(5) * 7 + 1 == 36 && u256(0) - 1 > u256(1));
+    const bigint a("123456789012345678901234567890123456789012345678901234567890");
+    const u256 x(a);
+    assert(bigint(x * x) == bigint("49406212495309828119615973668676649672006779568169819470318491209690506138692"));
+    assert(bigint(-x) == bigint("115792089237316195300114195996342228952035416775517107250445238329011895072046"));
+    assert(-x + x == 0 && u256(0) - 1 == u256(bigint(-1)) && u256(0) - 1 > x);
+    u256 counter = u256(0) - 1;
+    ++counter;
+    assert(counter == 0 && --counter == u256(0) - 1);
+    std::cout << "Test 1 Passed: x * x mod 2^256 = " << x * x << "\n";
+
+    // Test 2: Signed values in two's complement
+    using i128 = fixed_int<128, true>;
+    static_assert(i128(-5) * 7 == -35 && i128(-5) < i128(3) && -i128(-5) == 5);
+    const i128 y(a);
+    assert(bigint(y * y * y) == bigint("-25263581735713683313581817450812848184"));
+    assert(i128(bigint("-170141183460469231731687303715884105728")) < i128(INT64_MIN));
+    assert(bigint(i128(-1)) == -1 && bigint(i128(std::numeric_limits<int64_t>::min())) == bigint(std::numeric_limits<int64_t>::min()));
+    std::cout << "Test 2 Passed: y^3 as a signed 128-bit integer = " << y * y * y << "\n";
+
+    // Test 3: Wide values agree with bigint arithmetic reduced modulo 2^Bits
+    const bigint m4096 = pow(bigint(2), 4096);
+    bigint p = pow(a, 60), q = -pow(a + 1, 55);
+    const fixed_int<4096> fp(p), fq(q);
+    auto reduce = [](bigint v, const bigint& m) {
+        v %= m;
+        return v < 0 ? v + m : v;
+    };
+    assert(bigint(fp * fq) == reduce(p * q, m4096));
+    assert(bigint(fp + fq) == reduce(p + q, m4096) && bigint(fp - fq) == reduce(p - q, m4096));
+    const fixed_int<512> gp(p), gq(q);
+    const bigint m512 = pow(bigint(2), 512);
+    assert(bigint(gp * gq - gp) == reduce(p * q - p, m512));
+    std::cout << "Test 3 Passed: 512- and 4096-bit products match bigint\n";
+
+    // Test 4: Checked mode throws instead of wrapping
+    using c256 = fixed_int<256, true, overflow_mode::checked>;
+    const c256 max(bigint("57896044618658097711785492504343953926634992332820282019728792003956564819967"));
+    int thrown = 0;
+    auto expect_overflow = [&](auto&& operation) {
+        try {
+            operation();
+        } catch (const std::overflow_error&) {
+            ++thrown;
+        }
+    };
+    expect_overflow([&] { (void)(max + 1); });
+    expect_overflow([&] { (void)(-max - 2); });
+    expect_overflow([&] { (void)(max * 2); });
+    expect_overflow([&] { (void)c256(pow(bigint(2), 255)); });
+    expect_overflow([&] { (void)fixed_int<64, true, overflow_mode::checked>(std::numeric_limits<uint64_t>::max()); });
+    expect_overflow([&] { (void)-fixed_int<128, false, overflow_mode::checked>(1); });
+    assert(thrown == 6);
+    assert(-max - 1 == c256(-pow(bigint(2), 255)) && (max - 1) * -1 == 1 - max && c256(0) * -max == 0);
+    std::cout << "Test 4 Passed: checked overflow throws std::overflow_error\n";
+
+    std::cout << "All fixed_int tests passed successfully!\n";
+}
+
+void test_bigint_products() {
+    std::cout << "Running bigint product, sum and combinatorics tests...\n";
+
+    // Test 1: Products and sums of ranges
+    const std::vector<int> small{3, -4, 5, 7};
+    assert(bigint::product(small) == -420 && bigint::sum(small) == 11);
+    assert(bigint::product(std::vector<int>{}) == 1 && bigint::sum(std::vector<bigint>{}) == 0);
+    const std::vector<bigint> large{bigint("123456789012345678901234567890"), bigint(-3), bigint("1000000000000000000000")};
+    assert(bigint::product(large) == bigint("-370370367037037036703703703670000000000000000000000"));
+    assert(bigint::sum(large) == bigint("123456790012345678901234567887"));
+    std::vector<uint64_t> counts(1000);
+    for (uint64_t i = 0; i < counts.size(); ++i) counts[i] = 0xffffffffffffffc5u - i;
+    bigint folded(1);
+    for (const uint64_t c : counts) folded *= c;
+    assert(bigint::product(counts) == folded);
+    std::cout << "Test 1 Passed: product of 1000 64-bit values matches the left fold\n";
+
+    // Test 2: Factorials
+    assert(bigint::factorial(0) == 1 && bigint::factorial(1) == 1 && bigint::factorial(20) == 2432902008176640000u);
+    assert(bigint::factorial(25) == bigint("15511210043330985984000000"));
+    bigint f(1);
+    for (uint64_t i = 2; i <= 10000; ++i) f *= i;
+    assert(bigint::factorial(10000) == f);
+    std::cout << "Test 2 Passed: 25! = " << bigint::factorial(25) << "\n";
+
+    // Test 3: Binomial coefficients by both methods
+    assert(bigint::binomial(100, 50) == bigint("100891344545564193334812497256"));
+    assert(bigint::binomial(1000000, 3) == 166666166667000000 && bigint::binomial(1000000, 999997) == 166666166667000000);
+    assert(bigint::binomial(5, 6) == 0 && bigint::binomial(7, 0) == 1 && bigint::binomial(0, 0) == 1);
+    constexpr uint64_t max = std::numeric_limits<uint64_t>::max();
+    assert(bigint::binomial(max, 1) == max && bigint::binomial(max, max - 1) == max);
+    assert(bigint::binomial(max, 2) == bigint(max) * (max - 1) / 2);
+    assert(bigint::binomial(max, 3) == bigint(max) * (max - 1) * (max - 2) / 6);
+    assert(bigint::binomial(2000, 1000) == bigint::factorial(2000) / square(bigint::factorial(1000)));
+    for (uint64_t n = 0; n <= 60; ++n) {
+        for (uint64_t k = 1; k <= n; ++k) {
+            assert(bigint::binomial(n, k) == bigint::binomial(n - 1, k - 1) + bigint::binomial(n - 1, k));
+        }
+    }
+    std::cout << "Test 3 Passed: binomial(100, 50) = " << bigint::binomial(100, 50) << "\n";
+
+    // Test 4: Primorials
+    assert(bigint::primorial(0) == 1 && bigint::primorial(2) == 2 && bigint::primorial(30) == 6469693230);
+    assert(bigint::primorial(100) == bigint("2305567963945518424753102147331756070"));
+    std::cout << "Test 4 Passed: 100# = " << bigint::primorial(100) << "\n";
+
+    std::cout << "All bigint product, sum and combinatorics tests passed successfully!\n";
+}
+
+void test_bigint_stats() {
+    std::cout << "Running bigint statistics tests...\n";
+    using bigint_detail::algorithm_kind;
+    using bigint_detail::operation_kind;
+
+    const bigint a(std::string(1200, '7'));
+    const bigint b(std::string(900, '3'));
+    bigint::reset_stats();
+    const bigint product = a * b;
+    const bigint square = a * a;
+    const bigint quotient = a / b;
+    const bigint sum = a + b;
+    std::ostringstream text;
+    text << product;
+    const bigint parsed(text.str());
+    const bigint_detail::statistics stats = bigint::stats();
+    assert(parsed == product && quotient == a / b && sum - b == a && square == a * a);
+
+#ifdef BIGINT_ENABLE_STATS
+    // Test 1: Operations are counted once each, in the bucket of their operand size
+    assert(stats[operation_kind::multiply].count == 1 && stats[operation_kind::square].count == 1);
+    assert(stats[operation_kind::multiply].by_size[bigint_detail::size_bucket(63)] == 1);
+    assert(stats[operation_kind::divide].count == 1 && stats[operation_kind::add].count == 1);
+    assert(stats[operation_kind::print].count == 1 && stats[operation_kind::parse].count == 1);
+    assert(stats[operation_kind::multiply].cycles > 0);
+    std::cout << "Test 1 Passed: " << stats[operation_kind::multiply].cycles << " cycles in one product\n";
+
+    // Test 2: Algorithm selections follow the tuning thresholds
+    assert(stats[algorithm_kind::toom3] + stats[algorithm_kind::toom4] + stats[algorithm_kind::karatsuba] > 0);
+    assert(stats[algorithm_kind::sqr_basecase] > 0 && stats[algorithm_kind::mul_basecase] > 0);
+    assert(stats[algorithm_kind::div_basecase] + stats[algorithm_kind::div_burnikel_ziegler] > 0);
+    assert(stats[algorithm_kind::powmod_montgomery] == 0);
+    std::cout << "Test 2 Passed: " << stats[algorithm_kind::mul_basecase] << " schoolbook products\n";
+
+    // Test 3: Allocations are counted and reset clears every counter
+    assert(stats.allocations > 0 && stats.allocated_bytes >= 8 * stats.allocations);
+    bigint::reset_stats();
+    const bigint_detail::statistics cleared = bigint::stats();
+    assert(cleared.allocations == 0 && cleared[operation_kind::multiply].count == 0);
+    assert(cleared[algorithm_kind::mul_basecase] == 0);
+    std::cout << "Test 3 Passed: " << stats.allocations << " allocations of " << stats.allocated_bytes << " bytes\n";
+#else
+    // Test 1: Without BIGINT_ENABLE_STATS nothing is counted
+    assert(stats[operation_kind::multiply].count == 0 && stats[algorithm_kind::mul_basecase] == 0);
+    assert(stats.allocations == 0 && stats.scratch_bytes == 0);
+    std::cout << "Test 1 Passed: statistics are disabled and stay zero\n";
+#endif
+    assert(bigint_detail::name(operation_kind::powmod) == "powmod");
+    assert(bigint_detail::name(algorithm_kind::div_burnikel_ziegler) == "div_burnikel_ziegler");
+
+    std::cout << "All bigint statistics tests passed successfully!\n";
+}
+
+void test_bigint_binary_io() {
+    std::cout << "Running bigint binary import and export tests...\n";
+    const bigint value("4759477275222530853130");  // 0x0102030405060708090a
+    auto bytes = [](std::initializer_list<int> list) {
+        std::vector<std::byte> result;
+        for (const int b : list) result.push_back(static_cast<std::byte>(b));
+        return result;
+    };
+    auto exported = [&value](std::endian order, size_t word_size, std::endian endian) {
+        std::vector<std::byte> out(value.export_size(word_size));
+        assert(value.export_bytes(out, order, word_size, endian) == out.size());
+        return out;
+    };
+
+    // Test 1: Byte and word layouts
+    assert(value.export_size() == 10 && value.export_size(4) == 12 && bigint().export_size(8) == 0);
+    assert(exported(std::endian::little, 1, std::endian::native) == bytes({10, 9, 8, 7, 6, 5, 4, 3, 2, 1}));
+    assert(exported(std::endian::big, 1, std::endian::native) == bytes({1, 2, 3, 4, 5, 6, 7, 8, 9, 10}));
+    assert(exported(std::endian::big, 4, std::endian::big) == bytes({0, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10}));
+    assert(exported(std::endian::little, 4, std::endian::little) == bytes({10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0, 0}));
+    assert(exported(std::endian::little, 4, std::endian::big) == bytes({7, 8, 9, 10, 3, 4, 5, 6, 0, 0, 1, 2}));
+    assert(exported(std::endian::big, 4, std::endian::little) == bytes({2, 1, 0, 0, 6, 5, 4, 3, 10, 9, 8, 7}));
+    std::cout << "Test 1 Passed: " << value << " in every byte and word order\n";
+
+    // Test 2: Round trips of every layout, with leading zero words and explicit signs
+    uint64_t state = 2024;
+    for (size_t length = 0; length <= 40; ++length) {
+        std::string digits = "1";
+        for (size_t i = 0; i < length * 3; ++i) {
+            state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+            digits.push_back(static_cast<char>('0' + (state >> 60) % 10));
+        }
+        const bigint x(digits);
+        for (const size_t word_size : {size_t{1}, size_t{2}, size_t{3}, size_t{8}, size_t{16}}) {
+            for (const std::endian order : {std::endian::little, std::endian::big}) {
+                for (const std::endian endian : {std::endian::little, std::endian::big}) {
+                    std::vector<std::byte> out(x.export_size(word_size) + 1);
+                    const std::span<std::byte> words = std::span(out).first(x.export_bytes(out, order, word_size, endian));
+                    std::vector<std::byte> padded(2 * word_size, std::byte{0});
+                    padded.insert(order == std::endian::little ? padded.begin() : padded.end(), words.begin(), words.end());
+                    bigint y;
+                    assert(y.import_bytes(words, false, order, word_size, endian) == x);
+                    assert(y.import_bytes(padded, true, order, word_size, endian) == -x);
+                }
+            }
+        }
+    }
+    bigint zero(5);
+    assert(zero.import_bytes(bytes({0, 0, 0, 0}), true) == 0 && !(zero < 0));
+    std::cout << "Test 2 Passed: round trips of 41 values in 20 layouts\n";
+
+    // Test 3: Importing into existing capacity does not allocate
+    const bigint big(std::string(600, '8'));
+    std::vector<std::byte> buffer(big.export_size(8));
+    big.export_bytes(buffer, std::endian::big, 8, std::endian::big);
+    bigint target = big * 3;
+    const size_t before = allocation_count;
+    target.import_bytes(buffer, false, std::endian::big, 8, std::endian::big);
+    assert(allocation_count == before && target == big);
+    std::cout << "Test 3 Passed: " << buffer.size() << " bytes imported in place\n";
+
+    // Test 4: Invalid sizes
+    bool threw = false;
+    try {
+        std::vector<std::byte> small(9);
+        value.export_bytes(small);
+    } catch (const std::invalid_argument&) {
+        threw = true;
+    }
+    assert(threw);
+    threw = false;
+    try {
+        target.import_bytes(bytes({1, 2, 3}), false, std::endian::little, 2);
+    } catch (const std::invalid_argument&) {
+        threw = true;
+    }
+    assert(threw);
+    std::cout << "Test 4 Passed: short buffers and partial words are rejected\n";
+
+    std::cout << "All bigint binary import and export tests passed successfully!\n";
+}
+
+void test_bigint_streams() {
+    std::cout << "Running bigint stream and file tests...\n";
+
+    // Test 1: Extraction of several numbers and failure without digits
+    std::istringstream input("  -123 456\n0007abc -x");
+    bigint a, b, c;
+    assert(input >> a >> b >> c && a == -123 && b == 456 && c == 7);
+    std::string word;
+    assert(input >> word && word == "abc");
+    assert(!(input >> c) && c == 7);
+    std::istringstream tight(" 5");
+    tight >> std::noskipws;
+    assert(!(tight >> c) && c == 7);
+    std::cout << "Test 1 Passed: read " << a << ", " << b << " and " << c << "\n";
+
+    // Test 2: Numbers of many blocks match the string constructor
+    const size_t block = bigint_detail::stream_block_digits;
+    uint64_t state = 99;
+    std::string digits;
+    for (size_t i = 0; i < 2 * block + 1234; ++i) {
+        state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+        digits.push_back(static_cast<char>('0' + (state >> 60) % 10));
+    }
+    digits[0] = '9';
+    for (const size_t length : {size_t{1000}, block, block + 1, 2 * block + 1234}) {
+        std::istringstream stream("-" + digits.substr(0, length) + " tail");
+        bigint value;
+        assert(stream >> value && value == -bigint(digits.substr(0, length)) && !stream.eof());
+    }
+    std::istringstream at_end(digits);
+    bigint whole;
+    assert(at_end >> whole && at_end.eof() && whole == bigint(digits));
+    std::cout << "Test 2 Passed: " << digits.size() << " digits read in blocks of " << block << "\n";
+
+    // Test 3: Numbers longer than the print buffer are written in parts
+    const bigint huge = whole * pow(bigint(10), 30000) + 1;
+    std::ostringstream printed;
+    printed << -huge;
+    std::vector<char> text(huge.decimal_size() + 1);
+    const auto [end, ec] = to_chars(text.data() + 1, text.data() + text.size(), huge);
+    text[0] = '-';
+    assert(ec == std::errc{} && printed.str() == std::string_view(text.data(), end));
+    assert(printed.str().size() > bigint_detail::stream_buffer_bytes);
+    std::cout << "Test 3 Passed: printed " << printed.str().size() << " characters through a buffer of "
+              << bigint_detail::stream_buffer_bytes << "\n";
+
+    // Test 4: Files round trip and reject anything but one number
+    const std::filesystem::path path = std::filesystem::temp_directory_path() / "bigint_test_number.txt";
+    huge.write_file(path);
+    assert(bigint::read_file(path) == huge);
+    bigint(-42).write_file(path);
+    assert(bigint::read_file(path) == -42);
+    std::ofstream(path) << "\n  17 \n";
+    assert(bigint::read_file(path) == 17);
+    bool threw = false;
+    std::ofstream(path) << "17 18";
+    try {
+        (void)bigint::read_file(path);
+    } catch (const std::invalid_argument&) {
+        threw = true;
+    }
+    assert(threw);
+    std::filesystem::remove(path);
+    threw = false;
+    try {
+        (void)bigint::read_file(path);
+    } catch (const std::ios_base::failure&) {
+        threw = true;
+    }
+    assert(threw);
+    std::cout << "Test 4 Passed: write_file and read_file round trip\n";
+
+    std::cout << "All bigint stream and file tests passed successfully!\n";
+}
+
+void test_bigint_copy_on_write() {
+    std::cout << "Running bigint copy-on-write tests...\n";
+    const bigint original(std::string(3000, '7'));
+
+    // Test 1: Copies stay independent whichever of them is modified
+    bigint copy = original;
+    bigint negated = -original;
+    bigint later;
+    later = original;
+    copy += 1;
+    ++later;
+    assert(copy == later && copy - 1 == original && negated + original == 0);
+    bigint source = original;
+    const bigint kept = source;
+    source *= source;
+    assert(kept == original && source == original * original);
+    bigint counter = original;
+    const bigint previous = counter++;
+    assert(previous == original && counter == original + 1);
+    std::cout << "Test 1 Passed: copies, negations and post-increments are independent values\n";
+
+    // Test 2: Copies and negations of long values share their limbs
+    size_t before = allocation_count;
+    bigint shared = original;
+    bigint flipped = -shared;
+#ifdef BIGINT_COPY_ON_WRITE
+    assert(allocation_count == before);
+    shared -= 5;
+    assert(allocation_count == before + 1 && flipped == -original && shared + 5 == original);
+    std::cout << "Test 2 Passed: copy and negation took no allocation, the first change one\n";
+#else
+    assert(allocation_count == before + 2 && flipped == -shared);
+    std::cout << "Test 2 Passed: without BIGINT_COPY_ON_WRITE every copy allocates\n";
+#endif
+
+    // Test 3: Copies into another memory resource take their own limbs
+    std::pmr::monotonic_buffer_resource pool;
+    {
+        const bigint::memory_scope scope(&pool);
+        const bigint pooled = original;
+        assert(pooled.get_allocator().resource() == &pool && pooled == original);
+    }
+    std::cout << "Test 3 Passed: a copy made in a memory_scope allocates from its resource\n";
+
+    // Test 4: A value shared by several threads, each modifying its own copy
+    std::vector<bigint> results(4);
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < results.size(); ++t) {
+        threads.emplace_back([&original, &results, t] {
+            for (size_t i = 0; i < 50; ++i) {
+                bigint local = original;
+                local += t;
+                results[t] = local;
+            }
+        });
+    }
+    for (std::thread& thread : threads) thread.join();
+    for (size_t t = 0; t < results.size(); ++t) assert(results[t] - t == original);
+    std::cout << "Test 4 Passed: " << results.size() << " threads copied one value and changed their copies\n";
+
+    // Test 5: Overwriting a value that shares long limbs does not copy them first
+    bigint target = original;
+    const bigint five(5);
+    before = allocation_count;
+    target = five;
+    assert(target == 5 && allocation_count == before);
+    target = original;
+    before = allocation_count;
+    const std::byte two_limbs[16] = {std::byte{1}};
+    target.import_bytes(two_limbs, false);
+    assert(target == 1 && allocation_count == before);
+    std::cout << "Test 5 Passed: assigning and importing short values into a shared one took no allocation\n";
+
+    std::cout << "All bigint copy-on-write tests passed successfully!\n";
+}
+
 int main() {
     test_bigint_constructors();
     test_bigint_addition();
@@ -942,6 +2320,27 @@ int main() {
     test_bigint_string_multiplication();
     test_bigint_increment();
     test_bigint_decrement();
+    test_bigint_limb_boundaries();
+    test_bigint_small_buffer();
+    test_bigint_multiplication_algorithms();
+    test_bigint_parallel_multiplication();
+    test_bigint_in_place_operators();
+    test_bigint_expression_templates();
+    test_bigint_division();
+    test_bigint_decimal_conversion();
+    test_bigint_char_conversion();
+    test_bigint_powmod();
+    test_bigint_squaring();
+    test_bigint_simd_kernels();
+    test_bigint_memory_resource();
+    test_bigint_native_integers();
+    test_bigint_constexpr();
+    test_bigint_fixed_int();
+    test_bigint_products();
+    test_bigint_stats();
+    test_bigint_binary_io();
+    test_bigint_streams();
+    test_bigint_copy_on_write();
     return 0;
 }
 
@@ -0,0 +1,166 @@
+// Measures the algorithm crossover points of bigint on the current machine and writes
+// them as a header of BIGINT_*_THRESHOLD macros that bigint.hpp includes when present.
+#define BIGINT_NO_TUNING_HEADER
+#include "bigint.hpp"
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+static std::mt19937_64 rng(2024);
+static double batch_time = 0.004;
+
+/**
+ * @brief Returns a random positive bigint of exactly limbs limbs, built from decimal
+ *        digits so that large values are parsed in quasi-linear time.
+ */
+static bigint random_bigint(size_t limbs) {
+    const auto digits = static_cast<size_t>(static_cast<double>(limbs) * 19.2659197224948) + 1;
+    std::string text(digits, '0');
+    text[0] = '1';
+    for (size_t i = 1; i < digits; ++i) text[i] = static_cast<char>('0' + rng() % 10);
+    return bigint(text);
+}
+
+/**
+ * @brief Times op with threshold just above n and at n, in alternating batches of at
+ *        least batch_time so that drift in the machine's speed affects both alike.
+ *
+ * @return The best times per call over seven batches each, before and after.
+ */
+static std::pair<double, double> time_both(size_t& threshold, size_t n, const std::function<void()>& op) {
+    threshold = n + 1;
+    op();
+    size_t iterations = 1;
+    auto run = [&] {
+        const auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < iterations; ++i) op();
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    };
+    while (run() < batch_time) iterations *= 2;
+    double before = 1e300;
+    double after = 1e300;
+    for (int batch = 0; batch < 7; ++batch) {
+        threshold = n + 1;
+        before = std::min(before, run());
+        threshold = n;
+        after = std::min(after, run());
+    }
+    const auto count = static_cast<double>(iterations);
+    return {before / count, after / count};
+}
+
+/**
+ * @brief Finds the smallest size from which setting threshold to the size, so that the
+ *        faster algorithm runs at the top level, beats setting it just above the size.
+ *
+ *        Sizes grow geometrically from from to to. The crossover is the first size at
+ *        which the new algorithm wins three sizes in a row, which keeps timing noise
+ *        near the crossover from ending the search early.
+ *
+ * @param name Name of the threshold, for the progress output.
+ * @param threshold The tuning parameter to measure; left at the result.
+ * @param make_op Builds the operation to time at a given size.
+ * @return The crossover, or to if the new algorithm never won.
+ */
+static size_t find_crossover(const char* name, size_t& threshold, size_t from, size_t to,
+                             const std::function<std::function<void()>(size_t)>& make_op) {
+    size_t wins = 0;
+    size_t candidate = to;
+    for (size_t n = from; n <= to; n = std::max(n + 1, n * 9 / 8)) {
+        const auto [before, after] = time_both(threshold, n, make_op(n));
+        std::cerr << name << " " << n << ": " << before * 1e6 << " us -> " << after * 1e6 << " us\n";
+        if (after < before) {
+            if (wins++ == 0) candidate = n;
+            if (wins == 3) break;
+        } else {
+            wins = 0;
+            candidate = to;
+        }
+    }
+    threshold = candidate;
+    std::cerr << name << " = " << candidate << "\n";
+    return candidate;
+}
+
+int main(int argc, char** argv) {
+    std::filesystem::path output = "bigint_tuning.hpp";
+    size_t ntt_limit = 262144;
+    for (int i = 1; i < argc; ++i) {
+        const std::string_view arg = argv[i];
+        if (arg == "--quick") {
+            batch_time = 0.001;
+            ntt_limit = 131072;
+        } else if (arg.starts_with("--output=")) {
+            output = arg.substr(9);
+        } else {
+            std::cerr << "usage: tune [--quick] [--output=FILE]\n";
+            return 2;
+        }
+    }
+
+    // bigint.hpp only picks the file up from its own directory, so say early if it is elsewhere.
+    output = std::filesystem::absolute(output);
+    if (!std::filesystem::exists(output.parent_path() / "bigint.hpp")) {
+        std::cerr << "warning: " << output.parent_path().string() << " has no bigint.hpp, which will not include "
+                  << output.filename().string() << "; run tune from the directory of bigint.hpp or pass --output\n";
+    }
+
+    bigint_detail::tuning_parameters& t = bigint::tuning();
+    bigint r;
+    auto product = [&r](size_t n) -> std::function<void()> {
+        return [&r, a = random_bigint(n), b = random_bigint(n)] { r = a * b; };
+    };
+    auto squaring = [&r](size_t n) -> std::function<void()> {
+        return [&r, a = random_bigint(n)] { r = a * a; };
+    };
+
+    // Each tier is measured on top of the tiers below it, so the order matters.
+    find_crossover("mul_karatsuba", t.mul_karatsuba, 8, 128, product);
+    find_crossover("sqr_karatsuba", t.sqr_karatsuba, 8, 256, squaring);
+    find_crossover("mul_toom3", t.mul_toom3, std::max<size_t>(2 * t.mul_karatsuba, 16), 1024, product);
+    find_crossover("mul_toom4", t.mul_toom4, t.mul_toom3 + t.mul_toom3 / 2, 4096, product);
+    find_crossover("mul_ntt", t.mul_ntt, std::max<size_t>(t.mul_toom4, 1024), ntt_limit, product);
+    find_crossover("div_burnikel_ziegler", t.div_burnikel_ziegler, 8, 512, [&r](size_t n) -> std::function<void()> {
+        return [&r, a = random_bigint(2 * n), b = random_bigint(n)] { r = a / b; };
+    });
+    find_crossover("str_divide_conquer", t.str_divide_conquer, 4, 512, [](size_t n) -> std::function<void()> {
+        return [a = random_bigint(n), buffer = std::vector<char>(n * 20 + 2)]() mutable {
+            (void)to_chars(buffer.data(), buffer.data() + buffer.size(), a);
+        };
+    });
+    // Montgomery form is used below the threshold, so here the new algorithm is division.
+    find_crossover("powmod_division", t.powmod_division, 8, 2048, [&r](size_t n) -> std::function<void()> {
+        bigint mod = random_bigint(n);
+        if (mod % 2 == 0) ++mod;
+        return [&r, base = random_bigint(n), exp = random_bigint(4), mod] { r = bigint::powmod(base, exp, mod); };
+    });
+
+    std::ofstream out(output);
+    out << "// Generated by tune.cpp for the machine it ran on. Run it again to re-tune.\n"
+           "#ifndef BIGINT_TUNING_HPP\n"
+           "#define BIGINT_TUNING_HPP\n\n";
+    const std::pair<const char*, size_t> macros[] = {
+        {"BIGINT_MUL_KARATSUBA_THRESHOLD", t.mul_karatsuba},
+        {"BIGINT_MUL_TOOM3_THRESHOLD", t.mul_toom3},
+        {"BIGINT_MUL_TOOM4_THRESHOLD", t.mul_toom4},
+        {"BIGINT_MUL_NTT_THRESHOLD", t.mul_ntt},
+        {"BIGINT_DIV_BURNIKEL_ZIEGLER_THRESHOLD", t.div_burnikel_ziegler},
+        {"BIGINT_POWMOD_DIVISION_THRESHOLD", t.powmod_division},
+        {"BIGINT_STR_DIVIDE_CONQUER_THRESHOLD", t.str_divide_conquer},
+        {"BIGINT_SQR_KARATSUBA_THRESHOLD", t.sqr_karatsuba},
+    };
+    for (const auto& [macro, value] : macros) {
+        out << "#ifndef " << macro << "\n#define " << macro << " " << value << "\n#endif\n";
+    }
+    out << "\n#endif\n";
+    std::cerr << "wrote " << output.string() << "\n";
+    return out ? 0 : 1;
+}